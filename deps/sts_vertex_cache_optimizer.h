@@ -92,6 +92,12 @@ STSTVCOF float stsvco_compute_ACMR( const unsigned int *indices, const unsigned
 #include <math.h>
 #include <stdlib.h>
 
+// define both to route the allocations elsewhere
+#if !defined(STS_VCO_MALLOC) || !defined(STS_VCO_FREE)
+#define STS_VCO_MALLOC(sz) malloc(sz)
+#define STS_VCO_FREE(p) free(p)
+#endif
+
 // Computes the score for a vertex with numTris using the vertex
 STSTVCOF float stsvco_valenceScore( const int numTris ) {
     return 2*powf((float)numTris, -.5f );
@@ -115,11 +121,11 @@ STSTVCOF void stsvco_optimize( unsigned int *indices, const unsigned int numIndi
 
     if( numIndices <= 3 || numVertices <= 3) return;
 
-    vertex   *vertices = (vertex*)malloc( numVertices*sizeof(vertex) ) ;
+    vertex   *vertices = (vertex*)STS_VCO_MALLOC( numVertices*sizeof(vertex) ) ;
     assert( vertices && "Out of memory when allocating vertices");
 
     const int   numTriangles = numIndices/3;
-    triangle   *triangles = (triangle*)malloc( numTriangles*sizeof(triangle) );
+    triangle   *triangles = (triangle*)STS_VCO_MALLOC( numTriangles*sizeof(triangle) );
     assert( triangles && "Out of memory when allocating triangles");
 
     for(unsigned int v = 0; v < numVertices; ++v) {
@@ -145,7 +151,7 @@ STSTVCOF void stsvco_optimize( unsigned int *indices, const unsigned int numIndi
     }
 
     const int numVertToTri = vertices[numVertices-1].triListIndex+vertices[numVertices-1].numAdjecentTris;
-    unsigned int *vertToTri = (unsigned int*)malloc( numVertToTri * sizeof( unsigned int) );
+    unsigned int *vertToTri = (unsigned int*)STS_VCO_MALLOC( numVertToTri * sizeof( unsigned int) );
 
     for(int t = 0; t < numTriangles; ++t) {
         for(int v = 0; v < 3; ++v) {
@@ -158,8 +164,8 @@ STSTVCOF void stsvco_optimize( unsigned int *indices, const unsigned int numIndi
 
     // Make LRU cache
     const int   LRUCacheSize = cacheSize;
-    int         *LRUCache = (int*)malloc( LRUCacheSize* sizeof( int ) );
-    float       *scoring = (float*)malloc( LRUCacheSize*sizeof(float ) );
+    int         *LRUCache = (int*)STS_VCO_MALLOC( LRUCacheSize* sizeof( int ) );
+    float       *scoring = (float*)STS_VCO_MALLOC( LRUCacheSize*sizeof(float ) );
 
     for(int i = 0; i < LRUCacheSize; ++i) {
         LRUCache[i] = -1;
@@ -279,17 +285,17 @@ STSTVCOF void stsvco_optimize( unsigned int *indices, const unsigned int numIndi
     }
 
     // Memory cleanup
-    free( scoring );
-    free( LRUCache );
-    free( vertToTri );
-    free( vertices );
-    free( triangles );
+    STS_VCO_FREE( scoring );
+    STS_VCO_FREE( LRUCache );
+    STS_VCO_FREE( vertToTri );
+    STS_VCO_FREE( vertices );
+    STS_VCO_FREE( triangles );
 };
 
 float stsvco_compute_ACMR( const unsigned int *indices, const unsigned int numIndices, const unsigned int cacheSize ) {
 
     unsigned int numCacheMisses = 0;
-    int *cache = (int*)malloc( cacheSize*sizeof(int) );
+    int *cache = (int*)STS_VCO_MALLOC( cacheSize*sizeof(int) );
 
     assert( !(numIndices % 3) && "Index input has to be triangles" );
 
@@ -313,7 +319,7 @@ float stsvco_compute_ACMR( const unsigned int *indices, const unsigned int numIn
         }
     }
 
-    free( cache );
+    STS_VCO_FREE( cache );
 
     return (float)numCacheMisses/(float)(numIndices/3);
 };
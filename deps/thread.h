@@ -25,10 +25,12 @@ extern "C" {
 #ifdef _WIN32
 typedef HANDLE mt_thread;
 typedef CRITICAL_SECTION mt_mutex;
+typedef CONDITION_VARIABLE mt_cond;
 typedef volatile LONG mt_atomic_int32;
 #else
 typedef pthread_t mt_thread;
 typedef pthread_mutex_t mt_mutex;
+typedef pthread_cond_t mt_cond;
 typedef volatile int32_t mt_atomic_int32;
 #endif
 
@@ -97,6 +99,48 @@ static inline void mt_mutex_unlock(mt_mutex* mutex) {
 #endif
 }
 
+static inline int mt_cond_init(mt_cond* cond) {
+#ifdef _WIN32
+    InitializeConditionVariable(cond);
+    return 0;
+#else
+    return pthread_cond_init(cond, NULL);
+#endif
+}
+
+static inline void mt_cond_destroy(mt_cond* cond) {
+#ifdef _WIN32
+    (void)cond;
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+//mutex has to be locked, it is released while waiting. Can wake up spuriously.
+static inline void mt_cond_wait(mt_cond* cond, mt_mutex* mutex) {
+#ifdef _WIN32
+    SleepConditionVariableCS(cond, mutex, INFINITE);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+static inline void mt_cond_signal(mt_cond* cond) {
+#ifdef _WIN32
+    WakeConditionVariable(cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+static inline void mt_cond_broadcast(mt_cond* cond) {
+#ifdef _WIN32
+    WakeAllConditionVariable(cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
 static inline void mt_atomic_init(mt_atomic_int32* a, int32_t value) {
     *a = value;
 }
@@ -290,6 +290,15 @@ twp__STORAGE int twp_get_info_from_memory(void *data, int data_len, int *width,
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+
+// define all four to route the allocations elsewhere
+#if !defined(twp_MALLOC) || !defined(twp_CALLOC) || !defined(twp_REALLOC) || !defined(twp_FREE)
+#define twp_MALLOC(sz) malloc(sz)
+#define twp_CALLOC(n, sz) calloc(n, sz)
+#define twp_REALLOC(p, old_sz, new_sz) realloc(p, new_sz)
+#define twp_FREE(p) free(p)
+#endif
+
 #ifdef twp__SSE2
 #include <emmintrin.h>
 #endif
@@ -531,7 +540,7 @@ twp__INLINE static int twp__read_bits(twp__bit_reader *reader, int n)
 
 static uint16_t *twp__allocate_huffman_entries(int count)
 {
-    uint16_t *entries = (uint16_t *)malloc(count * sizeof(*entries));
+    uint16_t *entries = (uint16_t *)twp_MALLOC(count * sizeof(*entries));
     for (int i = 0; i < count; ++i)
         entries[i] = twp__INVALID_HUFFMAN_SYMBOL_MASK;
     return entries;
@@ -571,8 +580,8 @@ static void twp__free_huffman_table(twp__huffman_table *table)
 {
     for (int i = 0; i < table->num_subtables; ++i)
         twp__free_huffman_table(table->subtables + i);
-    free(table->subtables);
-    free(table->entries);
+    twp_FREE(table->subtables);
+    twp_FREE(table->entries);
     memset(table, 0, sizeof(*table));
 }
 
@@ -609,8 +618,9 @@ static int twp__insert_huffman_table_entry(twp__huffman_table *table, int code,
 
             twp__assert(table->num_subtables < (1 << twp__HUFFMAN_SPLIT));
             if (table->num_subtables >= table->max_subtables) {
+                int num_old_subtables = table->max_subtables;
                 table->max_subtables = table->max_subtables ? table->max_subtables*2 : 4;
-                table->subtables = (twp__huffman_table *)realloc(table->subtables, table->max_subtables * sizeof(twp__huffman_table));
+                table->subtables = (twp__huffman_table *)twp_REALLOC(table->subtables, num_old_subtables * sizeof(twp__huffman_table), table->max_subtables * sizeof(twp__huffman_table));
             }
 
             int subtable_idx = table->num_subtables++;
@@ -854,7 +864,7 @@ static int twp__read_prefix_code(twp__bit_reader *reader, int color_cache_size,
             return 0;
 
         int ok = 0;
-        int *code_lengths = (int *)calloc(num_code_length_symbols, sizeof(*code_lengths));
+        int *code_lengths = (int *)twp_CALLOC(num_code_length_symbols, sizeof(*code_lengths));
         int count = 0;
         for (;;) {
             if (count >= num_code_length_symbols) break;
@@ -906,7 +916,7 @@ static int twp__read_prefix_code(twp__bit_reader *reader, int color_cache_size,
         ok = 1;
 
 end:
-        free(code_lengths);
+        twp_FREE(code_lengths);
         twp__free_huffman_table(&code_lengths_ht);
         return ok;
     }
@@ -944,7 +954,7 @@ static twp__rgba8 *twp__read_coded_image(twp__bit_reader *reader, int width, int
         if (color_cache.pow2 < 1 || color_cache.pow2 > 11) goto err;
 
         color_cache.size = 1 << color_cache.pow2;
-        color_cache.cache = (twp__rgba8 *)calloc(color_cache.size, sizeof(twp__rgba8));
+        color_cache.cache = (twp__rgba8 *)twp_CALLOC(color_cache.size, sizeof(twp__rgba8));
     }
 
     if (main) { // only the main image has meta prefix codes, sub images do not
@@ -972,13 +982,13 @@ static twp__rgba8 *twp__read_coded_image(twp__bit_reader *reader, int width, int
     }
     ++num_prefix_code_groups;
 
-    prefix_code_groups = (twp__prefix_code_group *)malloc(num_prefix_code_groups * sizeof(twp__prefix_code_group));
+    prefix_code_groups = (twp__prefix_code_group *)twp_MALLOC(num_prefix_code_groups * sizeof(twp__prefix_code_group));
     for (int i = 0; i < num_prefix_code_groups; ++i) {
         if (!twp__read_prefix_code_group(reader, color_cache.size, prefix_code_groups + i))
             goto err;
     }
 
-    result = (twp__rgba8 *)malloc(num_pix * 4);
+    result = (twp__rgba8 *)twp_MALLOC(num_pix * 4);
     for (int i = 0; i < num_pix;) {
         int x = i % width;
         int y = i / width;
@@ -1064,18 +1074,18 @@ static twp__rgba8 *twp__read_coded_image(twp__bit_reader *reader, int width, int
     goto end;
 
 err:
-    free(result);
+    twp_FREE(result);
     result = NULL;
 
 end:
-    free(color_cache.cache);
-    free(meta_prefix.img);
+    twp_FREE(color_cache.cache);
+    twp_FREE(meta_prefix.img);
     for (int i = 0; i < num_prefix_code_groups; ++i) {
         for (int j = 0; j < 5; ++j) {
             twp__free_huffman_table(&prefix_code_groups[i].arr[j]);
         }
     }
-    free(prefix_code_groups);
+    twp_FREE(prefix_code_groups);
     return result;
 }
 
@@ -1087,7 +1097,7 @@ static void twp__free_transforms(twp__transform *tfs, int count)
         switch (tf->type) {
             case twp__TRANSFORM_PREDICTOR:
             case twp__TRANSFORM_COLOR: {
-                free(tf->pred_col.img);
+                twp_FREE(tf->pred_col.img);
             } break;
 
             case twp__TRANSFORM_SUBTRACT_GREEN: {
@@ -1095,7 +1105,7 @@ static void twp__free_transforms(twp__transform *tfs, int count)
             } break;
 
             case twp__TRANSFORM_COLOR_INDEXING: {
-                free(tf->color_idxing.color_table);
+                twp_FREE(tf->color_idxing.color_table);
             } break;
 
             default: {
@@ -1231,7 +1241,7 @@ static twp__rgba8 *twp__reverse_transform(twp__rgba8 *img, int width, int height
                         int subimg_i = (y >> tf->pred_col.pow2)*tf->pred_col.width + (x >> tf->pred_col.pow2);
                         int pred_mode = tf->pred_col.img[subimg_i].g;
                         if (pred_mode >= 14) {
-                            free(img);
+                            twp_FREE(img);
                             return NULL;
                         }
 
@@ -1362,7 +1372,7 @@ static twp__rgba8 *twp__reverse_transform(twp__rgba8 *img, int width, int height
 
                 int bits_per_idx = 8 / tf->color_idxing.width_divider;
                 int idx_bit_mask = (1 << bits_per_idx) - 1;
-                twp__rgba8 *new_img = (twp__rgba8 *)malloc(tf->color_idxing.orig_width * height * 4);
+                twp__rgba8 *new_img = (twp__rgba8 *)twp_MALLOC(tf->color_idxing.orig_width * height * 4);
 
                 for (int y = 0; y < height; ++y) {
                     for (int x = 0; x < tf->color_idxing.orig_width; ++x) {
@@ -1375,7 +1385,7 @@ static twp__rgba8 *twp__reverse_transform(twp__rgba8 *img, int width, int height
                     }
                 }
 
-                free(img);
+                twp_FREE(img);
                 return new_img;
             }
         } break;
@@ -1453,14 +1463,14 @@ static unsigned char *twp__read_vp8l(void *data, int data_len, int *width, int *
     twp__free_transforms(transforms, num_transforms);
 
     if (img && format == twp_FORMAT_RGB) {
-        unsigned char *rgb = (unsigned char *)malloc(*width * *height * 3);
+        unsigned char *rgb = (unsigned char *)twp_MALLOC(*width * *height * 3);
         unsigned char *ptr = rgb;
         for (int i = 0; i < *width * *height; ++i) {
             *ptr++ = img[i].r;
             *ptr++ = img[i].g;
             *ptr++ = img[i].b;
         }
-        free(img);
+        twp_FREE(img);
         return rgb;
     } else {
         return (unsigned char *)img;
@@ -3064,7 +3074,7 @@ static int twp__read_vp8_header(twp__vp8_data *data, uint8_t *raw_bytes, int num
 
     // frame header finished, continue with macroblock prediction records
 
-    data->mb_infos = (twp__mb_info *)calloc(data->num_mbs, sizeof(*data->mb_infos));
+    data->mb_infos = (twp__mb_info *)twp_CALLOC(data->num_mbs, sizeof(*data->mb_infos));
 
     for (int mb_idx = 0; mb_idx < data->num_mbs; ++mb_idx) {
         twp__mb_info *mb_info = data->mb_infos + mb_idx;
@@ -3209,7 +3219,7 @@ static int twp__read_yuv_data(twp__vp8_data *data, twp_format format)
     int y_bufsize = data->luma_stride * (data->luma_height+1);
     int uv_bufsize = data->chroma_stride * (data->chroma_height+1);
     int a_bufsize = (format == twp_FORMAT_YUVA) ? (data->width * data->height) : 0;
-    data->plane_y = (uint8_t *)malloc(y_bufsize + uv_bufsize*2 + a_bufsize);
+    data->plane_y = (uint8_t *)twp_MALLOC(y_bufsize + uv_bufsize*2 + a_bufsize);
     data->plane_u = data->plane_y + y_bufsize;
     data->plane_v = data->plane_u + uv_bufsize;
 
@@ -3233,7 +3243,7 @@ static int twp__read_yuv_data(twp__vp8_data *data, twp_format format)
     uint8_t nz_left[twp__NUM_DCT_PLANES][4];
     uint8_t *nz_above[twp__NUM_DCT_PLANES];
     int nz_above_alloc_size = data->mbs_per_row*4 + data->mbs_per_row + data->mbs_per_row*2 + data->mbs_per_row*2; // y + y2 + u + v
-    uint8_t *nz_above_alloc = (uint8_t *)calloc(nz_above_alloc_size, sizeof(**nz_above));
+    uint8_t *nz_above_alloc = (uint8_t *)twp_CALLOC(nz_above_alloc_size, sizeof(**nz_above));
     nz_above[twp__DCT_PLANE_Y] = nz_above_alloc;
     nz_above[twp__DCT_PLANE_Y2] = nz_above[twp__DCT_PLANE_Y] + data->mbs_per_row*4;
     nz_above[twp__DCT_PLANE_U] = nz_above[twp__DCT_PLANE_Y2] + data->mbs_per_row;
@@ -3355,7 +3365,7 @@ static int twp__read_yuv_data(twp__vp8_data *data, twp_format format)
             curr_partition_idx = 0;
     }
 
-    free(nz_above_alloc);
+    twp_FREE(nz_above_alloc);
 
     for (int i = 0; i < data->num_dct_partitions; ++i) {
         if (data->dct_partitions[i].dec.err)
@@ -4290,7 +4300,7 @@ static uint8_t *twp_yuv_to_rgb(uint8_t *plane_y, uint8_t *plane_u, uint8_t *plan
     // floating point implementation
 
     int comp = rgba ? 4 : 3;
-    uint8_t *mem = (uint8_t *)malloc(img_width * img_height * comp);
+    uint8_t *mem = (uint8_t *)twp_MALLOC(img_width * img_height * comp);
 
     uint8_t *src_y = plane_y + luma_stride + 1;
     uint8_t *src_u = plane_u + chroma_stride + 1;
@@ -4418,8 +4428,8 @@ static uint8_t *twp__read_vp8(void *raw_bytes, int num_bytes, int *width, int *h
 end:;
 
     if (format != twp_FORMAT_YUV && format != twp_FORMAT_YUVA)
-        free(data.plane_y);
-    free(data.mb_infos);
+        twp_FREE(data.plane_y);
+    twp_FREE(data.mb_infos);
 
     return result;
 }
@@ -4505,7 +4515,7 @@ static int twp__read_alpha(void *data, int data_len, int width, int height, unsi
         }
     }
 
-    free(buf);
+    twp_FREE(buf);
     return 1;
 }
 
@@ -4591,7 +4601,7 @@ twp__STORAGE unsigned char *twp_read_from_memory(void *data, int data_len, int *
 
     if (chunks.ALPH.data && (format == twp_FORMAT_RGBA || format == twp_FORMAT_YUVA)) {
         if (!twp__read_alpha(chunks.ALPH.data, chunks.ALPH.size, *width, *height, result, format == twp_FORMAT_YUVA)) {
-            free(result);
+            twp_FREE(result);
             return NULL;
         }
     }
@@ -4661,7 +4671,7 @@ static unsigned char *twp__read_entire_file(const char *file_path, int *size)
     fseek(f, 0, SEEK_END);
     *size = ftell(f);
     fseek(f, 0, SEEK_SET);
-    void *mem = malloc(*size);
+    void *mem = twp_MALLOC(*size);
     fread(mem, 1, *size, f);
     fclose(f);
 
@@ -4752,7 +4762,7 @@ twp__STORAGE unsigned char *twp_read(const char *file_path, int *width, int *hei
     unsigned char *data = twp__read_entire_file(file_path, &size);
     if (!data) return NULL;
     unsigned char *result = twp_read_from_memory(data, size, width, height, format, flags);
-    free(data);
+    twp_FREE(data);
     return result;
 }
 
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+//  bench_anim.c
+//  Measures pk_play_gltf_anim on a large synthetic clip, with the keyframe
+//  cursors of the state kept between frames and with them cleared every frame,
+//  which makes every lookup a search, against a copy of the old linear scan.
+//  Runs without a window or gpu.
+//  Build with optimizations.
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <time.h>
+#define PK_NO_SAPP
+#include "../poki.c"
+
+#define CHANNELS 300
+#define KEYS 4000
+#define FPS 30.0f
+#define FRAMES 2000
+
+static double now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+//the keyframe lookup before the cursors, scans from the first key on every call
+static void find_keyframes_linear(float time, const pk_gltf_anim_channel* channel, int* key1, int* key2, float* t) {
+    for (int i = 0; i < channel->num_keyframes - 1; ++i) {
+        if (time >= channel->times[i] && time <= channel->times[i + 1]) {
+            *key1 = i;
+            *key2 = i + 1;
+            *t = (time - channel->times[i]) / (channel->times[i + 1] - channel->times[i]);
+            return;
+        }
+    }
+    *key1 = *key2 = channel->num_keyframes - 1;
+    *t = 0.0f;
+}
+
+//same work as pk_play_gltf_anim for the translation channels of the bench
+static double run_linear(const char* name, pk_gltf_anim* anim, pk_model* model, const float* times, int count) {
+    float checksum = 0.0f;
+    const double start = now_ns();
+    for (int f = 0; f < count; f++) {
+        for (int c = 0; c < anim->num_channels; c++) {
+            const pk_gltf_anim_channel* channel = &anim->channels[c];
+            int key1, key2;
+            float t;
+            find_keyframes_linear(times[f], channel, &key1, &key2, &t);
+            const float* v1 = &channel->values[key1 * 3];
+            const float* v2 = &channel->values[key2 * 3];
+            pk_node* node = &model->nodes[channel->target_node];
+            node->position = HMM_V3(HMM_Lerp(v1[0], t, v2[0]), HMM_Lerp(v1[1], t, v2[1]), HMM_Lerp(v1[2], t, v2[2]));
+            node->dirty = true;
+        }
+        checksum += model->nodes[f % model->node_count].position.X;
+    }
+    const double elapsed = now_ns() - start;
+    const double per_lookup = elapsed / ((double)count * anim->num_channels);
+    printf("%-22s %10.2f ns/channel  (checksum %.1f)\n", name, per_lookup, checksum);
+    return per_lookup;
+}
+
+//times come from a sequence, so all runs see the same playback
+static double run(const char* name, bool keep_cursors, pk_gltf_anim* anim, pk_gltf_anim_state* state, pk_model* model, const float* times, int count) {
+    memset(state->cursors, 0, sizeof(int) * state->num_cursors);
+    float checksum = 0.0f;
+    const double start = now_ns();
+    for (int f = 0; f < count; f++) {
+        if (!keep_cursors) {
+            memset(state->cursors, 0, sizeof(int) * state->num_cursors);
+        }
+        state->time = times[f];
+        pk_play_gltf_anim(anim, state, model, 0.0f);
+        checksum += model->nodes[f % model->node_count].position.X;
+    }
+    const double elapsed = now_ns() - start;
+    const double per_lookup = elapsed / ((double)count * anim->num_channels);
+    printf("%-22s %10.2f ns/channel  (checksum %.1f)\n", name, per_lookup, checksum);
+    return per_lookup;
+}
+
+int main(void) {
+    pk_allocator allocator = pk_default_allocator();
+
+    //one node per channel, all translations
+    pk_model model = { 0 };
+    model.node_count = CHANNELS;
+    model.nodes = pk_alloc(&allocator, CHANNELS * sizeof(pk_node));
+    memset(model.nodes, 0, CHANNELS * sizeof(pk_node));
+
+    pk_gltf_anim anim = { 0 };
+    anim.num_channels = CHANNELS;
+    anim.channels = pk_alloc(&allocator, CHANNELS * sizeof(pk_gltf_anim_channel));
+    memset(anim.channels, 0, CHANNELS * sizeof(pk_gltf_anim_channel));
+    anim.keys = pk_alloc(&allocator, CHANNELS * KEYS * 4 * sizeof(float));
+    for (int c = 0; c < CHANNELS; c++) {
+        pk_gltf_anim_channel* channel = &anim.channels[c];
+        channel->target_node = c;
+        channel->path = PK_ANIM_PATH_TRANSLATION;
+        channel->interpolation = PK_ANIM_INTERP_LINEAR;
+        channel->num_keyframes = KEYS;
+        channel->times = anim.keys + c * KEYS * 4;
+        channel->values = channel->times + KEYS;
+        for (int k = 0; k < KEYS; k++) {
+            channel->times[k] = (float)k / FPS;
+            channel->values[k * 3 + 0] = (float)k;
+            channel->values[k * 3 + 1] = 0.0f;
+            channel->values[k * 3 + 2] = 0.0f;
+        }
+    }
+    const float duration = (float)(KEYS - 1) / FPS;
+    anim.num_clips = 1;
+    anim.clips = pk_alloc(&allocator, sizeof(pk_gltf_anim_clip));
+    anim.clips[0] = (pk_gltf_anim_clip) { .name = "bench", .first_channel = 0, .num_channels = CHANNELS, .duration = duration };
+    anim.ready = true;
+
+    pk_gltf_anim_state state;
+    pk_init_gltf_anim_state(&allocator, &state, &anim);
+    state.loop = true;
+
+    static float playback[FRAMES];
+    static float seeks[FRAMES];
+    uint32_t seed = 1;
+    for (int f = 0; f < FRAMES; f++) {
+        //60 fps playback, which wraps around the end of the clip once, and random seeks
+        playback[f] = fmodf(duration - 10.0f + (float)f / 60.0f, duration);
+        seed = seed * 1664525u + 1013904223u;
+        seeks[f] = (float)(seed >> 8) / 16777216.0f * duration;
+    }
+
+    printf("%d channels x %d keys, %d frames\n", CHANNELS, KEYS, FRAMES);
+    const double linear = run_linear("linear playback", &anim, &model, playback, FRAMES);
+    const double search = run("search playback", false, &anim, &state, &model, playback, FRAMES);
+    const double cursor = run("cursor playback", true, &anim, &state, &model, playback, FRAMES);
+    const double linear_seeks = run_linear("linear seeks", &anim, &model, seeks, FRAMES);
+    const double search_seeks = run("search seeks", false, &anim, &state, &model, seeks, FRAMES);
+    const double cursor_seeks = run("cursor seeks", true, &anim, &state, &model, seeks, FRAMES);
+    printf("playback speedup: %.1fx over linear, %.1fx over search\n", linear / cursor, search / cursor);
+    printf("seek speedup: %.1fx over linear, %.1fx over search\n", linear_seeks / cursor_seeks, search_seeks / cursor_seeks);
+
+    pk_release_gltf_anim_state(&allocator, &state);
+    pk_release_gltf_anim(&allocator, &anim);
+    pk_free(&allocator, model.nodes);
+    return 0;
+}
@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+//  bench_mixer.c
+//  Measures the cost of the tmixer mix loop, without an audio device.
+//  Build with optimizations, and -mavx2 to measure the AVX2 kernels.
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <time.h>
+#include "../pk_audio/tmixer.c"
+
+#define SAMPLE_RATE 48000
+#define BLOCK 512
+#define SECONDS 4
+
+static double now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static const char* kernels(void) {
+#if defined(TM_USE_AVX2)
+    return "avx2";
+#elif defined(TM_USE_SSE)
+    return "sse";
+#elif defined(TM_USE_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+int main(void) {
+    static const int voice_counts[] = { 1, 16, 64, 256 };
+    static float pcm[2 * SAMPLE_RATE];
+    static float out[2 * BLOCK];
+
+    // one second of stereo noise
+    uint32_t seed = 1;
+    for (int i = 0; i < 2 * SAMPLE_RATE; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        pcm[i] = ((float)(seed >> 8) / 16777216.0f - 0.5f) * 0.1f;
+    }
+
+    printf("kernels: %s\n", kernels());
+    for (int v = 0; v < (int)(sizeof(voice_counts) / sizeof(voice_counts[0])); v++) {
+        const int voices = voice_counts[v];
+        tm_init((tm_callbacks){ 0 }, SAMPLE_RATE, voices);
+
+        const tm_buffer* buffer = NULL;
+        tm_create_buffer_interleaved_float(2, pcm, sizeof(pcm), &buffer);
+        for (int i = 0; i < voices; i++) {
+            tm_channel channel;
+            tm_add_loop(buffer, 0, 1.0f / voices, 1.0f, &channel);
+        }
+
+        // warm up, this also hands the queued voices to the mixer
+        tm_getsamples(out, BLOCK);
+
+        const int nsamples = SECONDS * SAMPLE_RATE;
+        const double start = now_ns();
+        for (int i = 0; i < nsamples; i += BLOCK) {
+            tm_getsamples(out, BLOCK);
+        }
+        const double elapsed = now_ns() - start;
+
+        printf("voices %4d: %8.3f ns/sample, %6.3f ns/sample/voice, %5.2f%% of realtime\n",
+            voices, elapsed / nsamples, elapsed / nsamples / voices,
+            100.0 * elapsed / (SECONDS * 1e9));
+
+        tm_shutdown();
+        tm_release_buffer(buffer);
+    }
+    return 0;
+}
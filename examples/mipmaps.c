@@ -12,6 +12,7 @@ static pk_cam cam;
 static sg_pipeline pip;
 static uint8_t model_buffer[BUFFER_SIZE];
 static pk_primitive prim;
+static bool prim_ready = false;
 static uint8_t webp_buffer[BUFFER_SIZE];
 static sg_image webp;
 static sg_view webp_view;
@@ -25,8 +26,24 @@ static pk_allocator allocator;
 
 static void primitive_loaded(m3d_t* m3d, void* udata) {
     (void)udata;
-    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d);
+    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d, &(pk_m3d_desc) {
+        .packed_vertices = true, //16 instead of 32 bytes per vertex
+    });
     pk_assert(ok);
+
+    //The index type is only known after loading, so the pipeline gets created here.
+    pip = sg_make_pipeline(&(sg_pipeline_desc) {
+        .layout = pk_packed_layout(),
+        .shader = sg_make_shader(pk_phong_tex_packed_shader_desc(sg_query_backend())),
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
+        .index_type = prim.index_type, //Poki picks uint16_t indices, if the model is small enough.
+        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+    });
+    prim_ready = true;
     pk_release_m3d_data(m3d);
 }
 
@@ -105,18 +122,6 @@ static void init(void) {
         .loaded_cb = dds_loaded,
     });
 
-    pip = sg_make_pipeline(&(sg_pipeline_desc) {
-        .layout = pk_pnt_layout(),
-        .shader = sg_make_shader(pk_phong_tex_shader_desc(sg_query_backend())),
-        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
-        .index_type = SG_INDEXTYPE_UINT32, //Poki loads gltf and m3d indices as uint32_t.
-        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
-        .depth = {
-            .compare = SG_COMPAREFUNC_LESS_EQUAL,
-            .write_enabled = true,
-        },
-    });
-
     pk_init_cam(&cam, &(pk_cam_desc) {
         .distance = 2.0f,
         .mindist = 0.5f,
@@ -127,7 +132,7 @@ static void init(void) {
 
 static void frame(void) {
     //keep loading stuff
-    sfetch_dowork();
+    pk_dowork();
     pk_update_cam(&cam, sapp_width(), sapp_height());
 
     sg_begin_pass(&(sg_pass) {
@@ -149,31 +154,33 @@ static void frame(void) {
         .direction = HMM_V3(-0.5f, 0.0f, -0.75f),
     };
 
-    sg_apply_pipeline(pip);
+    if (prim_ready) {
+        sg_apply_pipeline(pip);
 
-    sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(material));
-    sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
+        sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(material));
+        sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
 
 
-    pk_vs_params_t vs_params = {
-        .model = HMM_Translate(HMM_V3(0, -0.5f, 0)),
-        .proj = cam.proj,
-        .view = cam.view,
-        .viewpos = cam.eyepos,
-    };
-    sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
-    prim.bindings.views[0] = webp_view;
-    pk_draw_primitive(&prim, 1);
-
-    vs_params.model = HMM_Translate(HMM_V3(1.5f, -0.5f, 0.f));
-    sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
-    prim.bindings.views[0] = png_view;
-    pk_draw_primitive(&prim, 1);
-
-    vs_params.model = HMM_Translate(HMM_V3(-1.5f, -0.5f, 0.f));
-    sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
-    prim.bindings.views[0] = dds_view;
-    pk_draw_primitive(&prim, 1);
+        pk_vs_params_t vs_params = {
+            .model = HMM_Translate(HMM_V3(0, -0.5f, 0)),
+            .proj = cam.proj,
+            .view = cam.view,
+            .viewpos = cam.eyepos,
+        };
+        sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
+        prim.bindings.views[0] = webp_view;
+        pk_draw_primitive(&prim, 1);
+
+        vs_params.model = HMM_Translate(HMM_V3(1.5f, -0.5f, 0.f));
+        sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
+        prim.bindings.views[0] = png_view;
+        pk_draw_primitive(&prim, 1);
+
+        vs_params.model = HMM_Translate(HMM_V3(-1.5f, -0.5f, 0.f));
+        sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
+        prim.bindings.views[0] = dds_view;
+        pk_draw_primitive(&prim, 1);
+    }
 
     sg_end_pass();
     sg_commit();
@@ -42,7 +42,8 @@ static void init(void) {
 }
 
 static void frame(void) {
-    sfetch_dowork();
+    pk_dowork();
+    pk_audio_update();
 }
 
 static void cleanup(void) {
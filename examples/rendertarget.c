@@ -14,6 +14,7 @@ static pk_cam cam;
 static sg_pipeline offscreen_pip;
 static uint8_t model_buffer[BUFFER_SIZE];
 static pk_primitive prim;
+static bool prim_ready = false;
 static pk_bone_anim_set anim_set;
 static pk_bone_anim_state anim_state;
 static pk_texture tex;
@@ -24,8 +25,24 @@ static pk_allocator allocator;
 
 static void primitive_loaded(m3d_t* m3d, void* udata) {
     (void)udata;
-    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d);
+    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d, &(pk_m3d_desc) { 0 });
     pk_assert(ok);
+
+    //The index type is only known after loading, so the pipeline gets created here.
+    offscreen_pip = sg_make_pipeline(&(sg_pipeline_desc) {
+        .layout = pk_skinned_layout(),
+        .shader = sg_make_shader(pk_skinned_phong_tex_shader_desc(sg_query_backend())),
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
+        .index_type = prim.index_type, //Poki picks uint16_t indices, if the model is small enough.
+        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+        },
+    });
+    prim_ready = true;
     ok = pk_load_bone_anims(&allocator, &anim_set, m3d);
     pk_assert(ok && anim_set.anim_count > 0);
     anim_state.anim = 0;
@@ -90,6 +107,7 @@ static void init(void) {
         .indices = SG_RANGE(indices),
         .vertices = SG_RANGE(vertices),
         .num_elements = 6,
+        .index_type = SG_INDEXTYPE_UINT16,
     });
 
     //The texture for the primitive is gonna be the render result.
@@ -104,20 +122,6 @@ static void init(void) {
         .label = "rt_sampler",
     });
 
-    offscreen_pip = sg_make_pipeline(&(sg_pipeline_desc) {
-        .layout = pk_skinned_layout(),
-        .shader = sg_make_shader(pk_skinned_phong_tex_shader_desc(sg_query_backend())),
-        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
-        .index_type = SG_INDEXTYPE_UINT32, //Poki loads gltf and m3d indices as uint32_t.
-        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
-        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
-        .depth = {
-            .compare = SG_COMPAREFUNC_LESS_EQUAL,
-            .write_enabled = true,
-            .pixel_format = SG_PIXELFORMAT_DEPTH,
-        },
-    });
-
     display_pip = sg_make_pipeline(&(sg_pipeline_desc) {
         .shader = sg_make_shader(effect_shader_desc(sg_query_backend())),
         .layout.buffers[0].stride = 3 * sizeof(float),
@@ -136,7 +140,7 @@ static void init(void) {
 
 static void frame(void) {
     // Keep loading stuff.
-    sfetch_dowork();
+    pk_dowork();
 
     // Draw the scene to the fbo.
     pk_begin_rendertarget(&rt);
@@ -164,14 +168,16 @@ static void frame(void) {
         .shininess = 32.f,
     };
 
-    sg_apply_pipeline(offscreen_pip);
+    if (prim_ready) {
+        sg_apply_pipeline(offscreen_pip);
 
-    sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
-    sg_apply_uniforms(UB_pk_bone_matrices, &SG_RANGE(bones));
-    sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(mat));
-    sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
+        sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
+        sg_apply_uniforms(UB_pk_bone_matrices, &SG_RANGE(bones));
+        sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(mat));
+        sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
 
-    pk_draw_primitive(&prim, 1);
+        pk_draw_primitive(&prim, 1);
+    }
 
     pk_end_rendertarget();
 
@@ -18,17 +18,44 @@ static uint8_t model_buffer[BUFFER_SIZE];
 static bool model_ready = false;
 static pk_model model;
 static pk_gltf_anim anim;
+static pk_gltf_anim_state* anim_states; //the clips of this file animate different nodes, so all of them play
+static int num_anim_states;
 static uint8_t image_buffer[BUFFER_SIZE*2];
 static pk_texture tex;
 static pk_allocator allocator;
 
 static void model_loaded(cgltf_data* gltf, void* udata) {
     (void)udata;
-    bool ok = pk_load_gltf(&allocator, &model, gltf);
+    bool ok = pk_load_gltf(&allocator, &model, gltf, &(pk_gltf_desc) {
+        .merge_buffers = true, //one vertex and index buffer for the whole model
+        .queue_uploads = true, //pk_dowork uploads the buffers over the next frames
+    });
     pk_assert(ok);
     ok = pk_load_gltf_anim(&allocator, &anim, &model, gltf);
+    num_anim_states = ok ? anim.num_clips : 0;
+    if (num_anim_states > 0) {
+        anim_states = pk_alloc(&allocator, sizeof(pk_gltf_anim_state) * num_anim_states);
+    }
+    for (int i = 0; i < num_anim_states; i++) {
+        pk_init_gltf_anim_state(&allocator, &anim_states[i], &anim);
+        anim_states[i].clip = i;
+        anim_states[i].loop = true;
+    }
     pk_set_model_texture(&model, &tex, 0);
     pk_release_gltf_data(gltf);
+
+    //The index type is only known after loading, so the pipeline gets created here.
+    pip = sg_make_pipeline(&(sg_pipeline_desc) {
+        .layout = pk_pnt_layout(), //Poki loads vertex data as positions, normals and texcoords.
+        .shader = sg_make_shader(pk_unlit_tex_shader_desc(sg_query_backend())),
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
+        .index_type = model.index_type, //Poki picks uint16_t indices, if the model is small enough.
+        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+    });
     if(ok) model_ready = true;
 }
 
@@ -70,25 +97,13 @@ static void init(void) {
         .loaded_cb = model_loaded,
     });
 
-    pip = sg_make_pipeline(&(sg_pipeline_desc) {
-        .layout = pk_pnt_layout(), //Poki loads vertex data as positions, normals and texcoords.
-        .shader = sg_make_shader(pk_unlit_tex_shader_desc(sg_query_backend())),
-        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
-        .index_type = SG_INDEXTYPE_UINT32, //Poki loads gltf and m3d indices as uint32_t.
-        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
-        .depth = {
-            .compare = SG_COMPAREFUNC_LESS_EQUAL,
-            .write_enabled = true,
-        },
-    });
-
     //If you initialize a descriptor to 0, in most cases poki will pick some defaults.
     pk_init_cam(&cam, &(pk_cam_desc) { 0 });
 }
 
 static void frame(void) {
     //keep loading stuff
-    sfetch_dowork();
+    pk_dowork();
 
     sg_begin_pass(&(sg_pass) {
         .action.colors[0] = {
@@ -98,10 +113,12 @@ static void frame(void) {
         .swapchain = sglue_swapchain(),
     });
 
-    if (model_ready) {
+    if (model_ready && pk_model_ready(&model)) {
         pk_update_cam(&cam, sapp_width(), sapp_height());
 
-        pk_play_gltf_anim(&anim, (float)sapp_frame_duration());
+        for (int i = 0; i < num_anim_states; i++) {
+            pk_play_gltf_anim(&anim, &anim_states[i], &model, (float)sapp_frame_duration());
+        }
 
         sg_apply_pipeline(pip);
 
@@ -120,6 +137,10 @@ static void frame(void) {
 }
 
 static void cleanup(void) {
+    for (int i = 0; i < num_anim_states; i++) {
+        pk_release_gltf_anim_state(&allocator, &anim_states[i]);
+    }
+    pk_free(&allocator, anim_states);
     pk_shutdown();
     //Just let the os clean up the other stuff...
 }
@@ -14,6 +14,7 @@ static pk_cam cam;
 static sg_pipeline pip;
 static uint8_t model_buffer[BUFFER_SIZE];
 static pk_primitive prim;
+static bool prim_ready = false;
 static pk_bone_anim_set anim_set;
 static pk_bone_anim_state anim_state;
 static float blend_factor = 0.5f;
@@ -50,8 +51,22 @@ static void static_free(void* ptr, void* udata) {
 
 static void primitive_loaded(m3d_t* m3d, void* udata) {
     (void)udata;
-    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d);
+    bool ok = pk_load_m3d(&allocator, &prim, NULL, m3d, &(pk_m3d_desc) { 0 });
     pk_assert(ok);
+
+    //The index type is only known after loading, so the pipeline gets created here.
+    pip = sg_make_pipeline(&(sg_pipeline_desc) {
+        .layout = pk_skinned_layout(),
+        .shader = sg_make_shader(pk_skinned_phong_tex_shader_desc(sg_query_backend())),
+        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
+        .index_type = prim.index_type, //Poki picks uint16_t indices, if the model is small enough.
+        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+    });
+    prim_ready = true;
     ok = pk_load_bone_anims(&allocator, &anim_set, m3d);
     pk_assert(ok && anim_set.anim_count > 1);
     anim_state.anim = 0;
@@ -100,18 +115,6 @@ static void init(void) {
     pk_checker_texture(&tex);
     pk_texture_primitive(&prim, &tex, 0);
 
-    pip = sg_make_pipeline(&(sg_pipeline_desc) {
-        .layout = pk_skinned_layout(),
-        .shader = sg_make_shader(pk_skinned_phong_tex_shader_desc(sg_query_backend())),
-        .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
-        .index_type = SG_INDEXTYPE_UINT32, //Poki loads gltf and m3d indices as uint32_t.
-        .cull_mode = SG_CULLMODE_FRONT, //No need, to draw both sides of all the faces.
-        .depth = {
-            .compare = SG_COMPAREFUNC_LESS_EQUAL,
-            .write_enabled = true,
-        },
-    });
-
     pk_init_cam(&cam, &(pk_cam_desc) {
         .distance = 2.0f,
         .mindist = 1.0f,
@@ -122,7 +125,7 @@ static void init(void) {
 
 static void frame(void) {
     //keep loading stuff
-    sfetch_dowork();
+    pk_dowork();
 
     pk_update_cam(&cam, sapp_width(), sapp_height());
 
@@ -162,14 +165,16 @@ static void frame(void) {
         .swapchain = sglue_swapchain(),
     });
 
-    sg_apply_pipeline(pip);
+    if (prim_ready) {
+        sg_apply_pipeline(pip);
 
-    sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
-    sg_apply_uniforms(UB_pk_bone_matrices, &SG_RANGE(mat));
-    sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(material));
-    sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
+        sg_apply_uniforms(UB_pk_vs_params, &SG_RANGE(vs_params));
+        sg_apply_uniforms(UB_pk_bone_matrices, &SG_RANGE(mat));
+        sg_apply_uniforms(UB_pk_tex_material, &SG_RANGE(material));
+        sg_apply_uniforms(UB_pk_dir_light, &SG_RANGE(light));
 
-    pk_draw_primitive(&prim, 1);
+        pk_draw_primitive(&prim, 1);
+    }
 
     sg_end_pass();
     sg_commit();
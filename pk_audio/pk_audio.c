@@ -13,6 +13,19 @@ static void _pk_stream_cb(float* buffer, int num_frames, int num_channels, void*
     tm_getsamples(buffer, num_frames);
 }
 
+static pk_allocator _pk_audio_allocator;
+static void _pk_register_sound_assets(void);
+
+static void* _pk_audio_alloc(void* opaque, int bytes) {
+    (void)opaque;
+    return pk_alloc(&_pk_audio_allocator, (size_t)bytes);
+}
+
+static void _pk_audio_free(void* opaque, void* ptr) {
+    (void)opaque;
+    if (ptr) pk_free(&_pk_audio_allocator, ptr);
+}
+
 void pk_audio_setup(const pk_audio_desc* desc) {
     saudio_desc ad = { 0 };
     memcpy(&ad, &desc->saudio, sizeof(saudio_desc));
@@ -20,16 +33,31 @@ void pk_audio_setup(const pk_audio_desc* desc) {
         ad.stream_userdata_cb = _pk_stream_cb;
     }
     saudio_setup(&ad);
-    tm_init(desc->mixer_callbacks, saudio_sample_rate());
+
+    tm_callbacks callbacks = desc->mixer_callbacks;
+    if (!callbacks.allocate && desc->allocator.alloc) {
+        _pk_audio_allocator = desc->allocator;
+        callbacks.allocate = _pk_audio_alloc;
+        callbacks.free = _pk_audio_free;
+    }
+    tm_init(callbacks, saudio_sample_rate(), desc->max_sources);
+    _pk_register_sound_assets();
 }
 
 void pk_audio_shutdown() {
+    //cached sounds go, while the mixer can still release them
+    pk_set_asset_loader(PK_ASSET_SOUND, NULL);
     if (saudio_isvalid()) {
-        tm_shutdown();
+        // stop the audio thread before the mixer releases its sources
         saudio_shutdown();
+        tm_shutdown();
     }
 }
 
+void pk_audio_update(void) {
+    tm_update();
+}
+
 void pk_play_sound(pk_sound* sound, const pk_sound_channel_desc* desc) {
     pk_assert(desc->buffer);
     sound->channel = (tm_channel){ 0 };
@@ -59,6 +87,9 @@ void pk_play_sound(pk_sound* sound, const pk_sound_channel_desc* desc) {
         }
         else tm_add(desc->buffer, 0, 0.75f, 1.0f, &sound->channel);
     }
+    if (desc->priority != 0) {
+        tm_channel_set_priority(sound->channel, desc->priority);
+    }
 }
 
 void pk_update_sound(pk_sound* sound) {
@@ -84,33 +115,52 @@ typedef struct {
     pk_sound_buffer_loaded_callback loaded_cb;
     pk_fail_callback fail_cb;
     void* udata;
+    int decode_threshold;
 } sound_request_data;
 
-static void _sound_fetch_callback(const sfetch_response_t* response) {
-    sound_request_data data = *(sound_request_data*)response->user_data;
-
-    if (response->fetched) {
-        const tm_buffer* buffer = NULL;
+static const tm_buffer* _pk_create_sound_buffer(const sfetch_response_t* response, int decode_threshold) {
+    const tm_buffer* buffer = NULL;
+    if ((int)response->data.size < decode_threshold) {
+        tm_create_buffer_vorbis_decoded(response->data.ptr, (int)response->data.size, &buffer);
+        if (!buffer) {
+            pk_printf("Failed to decode sound: %s\n", response->path);
+        }
+    }
+    if (!buffer) {
         tm_create_buffer_vorbis_stream(
-            response->buffer.ptr,
-            (int)response->buffer.size,
+            response->data.ptr,
+            (int)response->data.size,
             NULL, NULL,
             &buffer
         );
+    }
+    return buffer;
+}
+
+static void _pk_log_sound_error(const sfetch_response_t* response) {
+    switch (response->error_code) {
+    case SFETCH_ERROR_FILE_NOT_FOUND: pk_printf("Sound file not found: %s\n", response->path); break;
+    case SFETCH_ERROR_BUFFER_TOO_SMALL: pk_printf("Sound buffer too small: %s\n", response->path); break;
+    default: break;
+    }
+}
+
+static void _sound_fetch_callback(const sfetch_response_t* response) {
+    sound_request_data data = *(sound_request_data*)response->user_data;
+
+    if (response->fetched) {
+        const tm_buffer* buffer = _pk_create_sound_buffer(response, data.decode_threshold);
         if (data.loaded_cb) {
             data.loaded_cb(buffer, data.udata);
         }
     }
     if (response->failed) {
-        switch (response->error_code) {
-        case SFETCH_ERROR_FILE_NOT_FOUND: pk_printf("Sound file not found: %s\n", response->path); break;
-        case SFETCH_ERROR_BUFFER_TOO_SMALL: pk_printf("Sound buffer too small: %s\n", response->path); break;
-        default: break;
-        }
+        _pk_log_sound_error(response);
         if (data.fail_cb) {
             data.fail_cb(response, data.udata);
         }
     }
+    pk_manage_fetch_buffer(response);
 }
 
 sfetch_handle_t pk_load_sound_buffer(const pk_sound_buffer_request* req) {
@@ -118,6 +168,7 @@ sfetch_handle_t pk_load_sound_buffer(const pk_sound_buffer_request* req) {
         .loaded_cb = req->loaded_cb,
         .fail_cb = req->fail_cb,
         .udata = req->udata,
+        .decode_threshold = req->decode_threshold,
     };
 
     return sfetch_send(&(sfetch_request_t) {
@@ -127,3 +178,55 @@ sfetch_handle_t pk_load_sound_buffer(const pk_sound_buffer_request* req) {
         .user_data = SFETCH_RANGE(data),
     });
 }
+
+
+//--asset-cache---------------------------------------------------------
+
+typedef struct {
+    pk_asset asset;
+    int decode_threshold;
+} sound_asset_data;
+
+static void _sound_asset_fetch_callback(const sfetch_response_t* response) {
+    sound_asset_data data = *(sound_asset_data*)response->user_data;
+
+    if (response->fetched) {
+        const tm_buffer* buffer = _pk_create_sound_buffer(response, data.decode_threshold);
+        if (!pk_resolve_asset(data.asset, (void*)buffer, (size_t)tm_get_buffer_size(buffer))) {
+            tm_release_buffer(buffer);
+        }
+    }
+    if (response->failed) {
+        _pk_log_sound_error(response);
+        pk_resolve_asset(data.asset, NULL, 0);
+    }
+    pk_manage_fetch_buffer(response);
+}
+
+static void _pk_load_sound_asset(pk_asset asset, const char* path, const void* params) {
+    sound_asset_data data = {
+        .asset = asset,
+        .decode_threshold = params ? ((const pk_sound_asset_params*)params)->decode_threshold : 0,
+    };
+
+    sfetch_send(&(sfetch_request_t) {
+        .path = path,
+        .callback = _sound_asset_fetch_callback,
+        .user_data = SFETCH_RANGE(data),
+    });
+}
+
+static void _pk_release_sound_asset(void* data) {
+    tm_release_buffer((const tm_buffer*)data);
+}
+
+static void _pk_register_sound_assets(void) {
+    pk_set_asset_loader(PK_ASSET_SOUND, &(pk_asset_loader) {
+        .load = _pk_load_sound_asset,
+        .release = _pk_release_sound_asset,
+    });
+}
+
+const tm_buffer* pk_asset_sound_buffer(pk_asset asset) {
+    return (const tm_buffer*)pk_asset_data(asset);
+}
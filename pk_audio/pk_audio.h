@@ -12,15 +12,21 @@ extern "C" {
 typedef struct pk_audio_desc {
     saudio_desc saudio;
     tm_callbacks mixer_callbacks;
+    pk_allocator allocator; //used by the mixer, unless mixer_callbacks has its own. Must be thread safe.
+    int max_sources; //default: 32
 } pk_audio_desc;
 
 void pk_audio_setup(const pk_audio_desc* desc);
+//drops the cached sounds, sound assets that are still acquired have to be released before
 void pk_audio_shutdown(void);
+//call once per frame, releases finished sounds and runs the channel_complete callback
+void pk_audio_update(void);
 
 /*
 Options for playing a sound.
 Filling in the node field will make the sound spatial.
 In this case, you should also fill in range_min and range_max.
+When all sources are busy, sounds with a lower priority are replaced first.
 */
 typedef struct pk_sound_channel_desc {
     const tm_buffer* buffer;
@@ -28,6 +34,7 @@ typedef struct pk_sound_channel_desc {
     float range_max;
     pk_node* node;
     bool loop;
+    int priority;
 } pk_sound_channel_desc;
 
 typedef struct pk_sound {
@@ -51,9 +58,15 @@ void pk_update_sound_listener(pk_sound_listener* listener, HMM_Vec3 new_pos, HMM
 
 typedef void(*pk_sound_buffer_loaded_callback)(const tm_buffer* buffer, void* udata);
 
+/*
+Sounds are streamed from the compressed file by default, with one decoder per playing source.
+Files smaller than decode_threshold bytes are decoded once into PCM that all sources share,
+which suits short effects that are fired often. Use tm_get_buffer_size to account for the memory.
+*/
 typedef struct pk_sound_buffer_request {
     const char* path;
     sfetch_range_t buffer;
+    int decode_threshold; //default: 0, always stream
     pk_sound_buffer_loaded_callback loaded_cb;
     pk_fail_callback fail_cb;
     void* udata;
@@ -62,6 +75,14 @@ typedef struct pk_sound_buffer_request {
 sfetch_handle_t pk_load_sound_buffer(const pk_sound_buffer_request* req);
 //since the header is included, just use tm_release_buffer(...) here.
 
+//pk_audio_setup registers the PK_ASSET_SOUND loader, so call it after pk_setup.
+//Sound assets can pass these as pk_asset_request.params.
+typedef struct pk_sound_asset_params {
+    int decode_threshold; //see pk_sound_buffer_request
+} pk_sound_asset_params;
+
+const tm_buffer* pk_asset_sound_buffer(pk_asset asset);
+
 
 
 #ifdef __cplusplus
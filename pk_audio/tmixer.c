@@ -7,15 +7,30 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "thread.h"
+#include "../deps/thread.h"
 #include "vorbis.c"
 
+// vector mixing kernels, picked at compile time. Define TM_NO_SIMD to force the scalar ones.
+#ifndef TM_NO_SIMD
+#  if defined(__AVX2__)
+#    define TM_USE_AVX2 1
+#    include <immintrin.h>
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define TM_USE_SSE 1
+#    include <emmintrin.h>
+#  elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    define TM_USE_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
 enum {
     TM_SOURCEFLAG_PLAYING = 1 << 0,
     TM_SOURCEFLAG_POSITIONAL = 1 << 1,
     TM_SOURCEFLAG_LOOPING = 1 << 2,
     TM_SOURCEFLAG_FADEOUT = 1 << 3,
     TM_SOURCEFLAG_FREQUENCY = 1 << 4,
+    TM_SOURCEFLAG_STEREO = 1 << 5,
 };
 
 typedef struct buffer_t buffer_t;
@@ -32,58 +47,151 @@ typedef struct buffer_functions_t {
 typedef struct buffer_t {
 	const buffer_functions_t* funcs;
 	mt_atomic_int32 refcnt;
+	int32_t sample_rate; // 0 if it matches the mixer
 } buffer_t;
 
 typedef struct static_source_data_t {
 	int32_t sample_pos;
 } static_source_data_t;
 
-typedef struct vorbis_stream_data_t {
+// decoded ahead of playback by the decoder thread
+typedef struct vorbis_stream_t {
 	stb_vorbis* v;
+	float* pcm[2];             // planar rings of N_STREAM_FRAMES, pcm[1] == pcm[0] for mono streams
+	mt_atomic_int32 write;     // frames decoded, advanced by the decoder
+	mt_atomic_int32 read;      // frames consumed, advanced by the mixer
+	mt_atomic_int32 finished;  // the decoder reached the end of a non-looping stream
+	int32_t pending;           // mixer only, handed out but not yet rendered
+	int32_t looping;
+	// decoder only, the part of the last vorbis frame that did not fit into the ring
 	const float* outputs[2];
 	int noutputs;
+	struct vorbis_stream_t* next;
+} vorbis_stream_t;
+
+typedef struct vorbis_stream_data_t {
+	vorbis_stream_t* stream;
 } vorbis_stream_data_t;
 
 typedef struct custom_stream_data_t {
 	void* opaque;
 } custom_stream_data_t;
 
+typedef union source_instance_data_t {
+	static_source_data_t static_source;
+	vorbis_stream_data_t vorbis_stream;
+	custom_stream_data_t custom_stream;
+} source_instance_data_t;
+
 typedef struct source_t {
 	const buffer_t* buffer;
-	union {
-		static_source_data_t static_source;
-		vorbis_stream_data_t vorbis_stream;
-		custom_stream_data_t custom_stream;
-	} instance_data;
+	source_instance_data_t instance_data;
 	float position[3];
 	float fadeout_per_sample;
 	float gain_base;
 	float distance_min;
 	float distance_difference;
 	float frequency;
-	uint16_t frame_age;
+	double rate_scale; // buffer sample rate / mixer sample rate
+	uint32_t generation;
 	uint8_t flags;
 	uint8_t gain_base_index;
 	tm_resampler resampler;
 	void* opaque;
 } source_t;
 
+// game thread -> mixer
+enum {
+	TM_CMD_ADD,
+	TM_CMD_STOP,
+	TM_CMD_SET_OPAQUE,
+	TM_CMD_SET_POSITION,
+	TM_CMD_FADEOUT,
+	TM_CMD_SET_GAIN,
+	TM_CMD_SET_FREQUENCY,
+	TM_CMD_SET_RESAMPLER,
+	TM_CMD_STOP_ALL,
+	TM_CMD_MASTER_GAIN,
+	TM_CMD_BASE_GAIN,
+	TM_CMD_CALLBACK_GAIN,
+	TM_CMD_LISTENER,
+	TM_CMD_COMPRESSOR,
+};
+
+typedef struct command_t {
+	uint8_t type;
+	uint8_t flags;
+	uint8_t gain_index;
+	int32_t slot;
+	uint32_t generation;
+	const buffer_t* buffer;
+	void* opaque;
+	source_instance_data_t instance_data;
+	float args[8];
+} command_t;
+
+// mixer -> game thread, one per finished source
+typedef struct completion_t {
+	const buffer_t* buffer;
+	source_instance_data_t instance_data;
+	void* opaque;
+	uint32_t generation;
+	int32_t slot;
+} completion_t;
+
+// single producer / single consumer ring indices; head and tail only ever grow
+typedef struct ring_t {
+	mt_atomic_int32 head; // written by the producer
+	mt_atomic_int32 tail; // written by the consumer
+} ring_t;
+
+// slot bookkeeping, only touched by the game thread
+typedef struct channel_state_t {
+	uint32_t generation;
+	uint32_t start_order;
+	float gain;
+	int priority;
+	uint8_t busy;    // the mixer may still own the slot
+	uint8_t playing; // not stopped and not reported as finished
+	uint8_t looping;
+} channel_state_t;
+
 #define N_GAINTYPES 8
-#define N_SOURCES 32
+#define N_SOURCES_DEFAULT 32
 #define N_SAMPLES 2048
 #define N_SAMPLESF (float)N_SAMPLES
+#define N_COMMANDS 512 // power of two
+#define N_STREAM_FRAMES 8192 // power of two, decoded frames kept ahead per vorbis source
 #define SPEAKER_DIST 0.17677669529663688110021109052621f // 1/(4 *sqrtf(2))
 
 static struct {
-	mt_mutex lock;
 	tm_callbacks callbacks;
+	int32_t sample_rate;
+	mt_atomic_int32 running;
+
+	int32_t max_sources;
+	void* pool; // one allocation for all per-source arrays below
+
+	// game thread
+	channel_state_t* channels;
+	int32_t* free_slots; // stack of idle slots
+	int32_t nfree;
+	uint32_t start_counter;
+
+	// lock-free queues between the two threads
+	ring_t commands;
+	ring_t completions;
+	uint32_t completion_mask;
+	command_t command_items[N_COMMANDS];
+	completion_t* completion_items;
+
+	// mixer thread
 	float position[3];
 	float forward[3];
 	float right[3];
 	float gain_master;
 	float gain_base[N_GAINTYPES];
 	float gain_callback;
-	int32_t sample_rate;
 	float compressor_last_samples[2];
 	float compressor_thresholds[2];
 	float compressor_multipliers[2];
@@ -91,7 +199,17 @@ static struct {
 	float compressor_attack_per1ksamples;
 	float compressor_release_per1ksamples;
 	int32_t samples_remaining;
-	source_t sources[N_SOURCES];
+	source_t* sources;
+	int32_t* playing;
+	float (*gains)[2];
+
+	// vorbis decoder thread, the mixer never takes decoder_lock
+	mt_thread decoder;
+	mt_mutex decoder_lock;
+	mt_cond decoder_wake;         // signalled for new streams, and by the mixer while the decoder is idle
+	mt_atomic_int32 decoder_idle; // the decoder waits for decoder_wake
+	mt_atomic_int32 decoder_running;
+	vorbis_stream_t* streams;
 	float buffer[2*N_SAMPLES];
 	float scratch[2*N_SAMPLES];
 } tm;
@@ -105,6 +223,104 @@ static inline float _tm_dist(const float* a, const float* b) {
 }
 static inline void _tm_vcopy(float* v, const float* a) { v[0] = a[0], v[1] = a[1], v[2] = a[2]; }
 
+//--kernels-----------------------------------------------------------------------------------------------
+
+// dst[i] += gain*src[i]
+static void _tm_mix_gain(float* dst, const float* src, float gain, int n) {
+	int ii = 0;
+#if defined(TM_USE_AVX2)
+	const __m256 g = _mm256_set1_ps(gain);
+	for (; ii + 8 <= n; ii += 8)
+		_mm256_storeu_ps(dst + ii, _mm256_add_ps(_mm256_loadu_ps(dst + ii), _mm256_mul_ps(g, _mm256_loadu_ps(src + ii))));
+#elif defined(TM_USE_SSE)
+	const __m128 g = _mm_set1_ps(gain);
+	for (; ii + 4 <= n; ii += 4)
+		_mm_storeu_ps(dst + ii, _mm_add_ps(_mm_loadu_ps(dst + ii), _mm_mul_ps(g, _mm_loadu_ps(src + ii))));
+#elif defined(TM_USE_NEON)
+	const float32x4_t g = vdupq_n_f32(gain);
+	for (; ii + 4 <= n; ii += 4)
+		vst1q_f32(dst + ii, vmlaq_f32(vld1q_f32(dst + ii), g, vld1q_f32(src + ii)));
+#endif
+	for (; ii < n; ++ii)
+		dst[ii] += gain * src[ii];
+}
+
+// max(|src[i]|)
+static float _tm_abs_max(const float* src, int n) {
+	int ii = 0;
+	float result = 0.0f;
+#if defined(TM_USE_AVX2)
+	const __m256 sign = _mm256_set1_ps(-0.0f);
+	__m256 m = _mm256_setzero_ps();
+	for (; ii + 8 <= n; ii += 8)
+		m = _mm256_max_ps(m, _mm256_andnot_ps(sign, _mm256_loadu_ps(src + ii)));
+	__m128 m4 = _mm_max_ps(_mm256_castps256_ps128(m), _mm256_extractf128_ps(m, 1));
+	m4 = _mm_max_ps(m4, _mm_movehl_ps(m4, m4));
+	m4 = _mm_max_ss(m4, _mm_shuffle_ps(m4, m4, 1));
+	result = _mm_cvtss_f32(m4);
+#elif defined(TM_USE_SSE)
+	const __m128 sign = _mm_set1_ps(-0.0f);
+	__m128 m = _mm_setzero_ps();
+	for (; ii + 4 <= n; ii += 4)
+		m = _mm_max_ps(m, _mm_andnot_ps(sign, _mm_loadu_ps(src + ii)));
+	m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+	m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+	result = _mm_cvtss_f32(m);
+#elif defined(TM_USE_NEON)
+	float32x4_t m = vdupq_n_f32(0.0f);
+	for (; ii + 4 <= n; ii += 4)
+		m = vmaxq_f32(m, vabsq_f32(vld1q_f32(src + ii)));
+	float32x2_t m2 = vpmax_f32(vget_low_f32(m), vget_high_f32(m));
+	result = vget_lane_f32(vpmax_f32(m2, m2), 0);
+#endif
+	for (; ii < n; ++ii) {
+		const float power = fabsf(src[ii]);
+		if (power > result)
+			result = power;
+	}
+	return result;
+}
+
+// out[2i] = clamp(left[i]), out[2i + 1] = clamp(right[i])
+static void _tm_clip_interleave(float* out, const float* left, const float* right, int n) {
+	int ii = 0;
+#if defined(TM_USE_AVX2)
+	const __m256 lo = _mm256_set1_ps(-1.0f);
+	const __m256 hi = _mm256_set1_ps(1.0f);
+	for (; ii + 8 <= n; ii += 8) {
+		const __m256 l = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(left + ii), lo), hi);
+		const __m256 r = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(right + ii), lo), hi);
+		// unpack works per 128 bit lane: a = l0 r0 l1 r1 | l4 r4 l5 r5, b = l2 r2 l3 r3 | l6 r6 l7 r7
+		const __m256 a = _mm256_unpacklo_ps(l, r);
+		const __m256 b = _mm256_unpackhi_ps(l, r);
+		_mm256_storeu_ps(out + 2*ii, _mm256_permute2f128_ps(a, b, 0x20));
+		_mm256_storeu_ps(out + 2*ii + 8, _mm256_permute2f128_ps(a, b, 0x31));
+	}
+#elif defined(TM_USE_SSE)
+	const __m128 lo = _mm_set1_ps(-1.0f);
+	const __m128 hi = _mm_set1_ps(1.0f);
+	for (; ii + 4 <= n; ii += 4) {
+		const __m128 l = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(left + ii), lo), hi);
+		const __m128 r = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(right + ii), lo), hi);
+		_mm_storeu_ps(out + 2*ii, _mm_unpacklo_ps(l, r));
+		_mm_storeu_ps(out + 2*ii + 4, _mm_unpackhi_ps(l, r));
+	}
+#elif defined(TM_USE_NEON)
+	const float32x4_t lo = vdupq_n_f32(-1.0f);
+	const float32x4_t hi = vdupq_n_f32(1.0f);
+	for (; ii + 4 <= n; ii += 4) {
+		float32x4x2_t lr;
+		lr.val[0] = vminq_f32(vmaxq_f32(vld1q_f32(left + ii), lo), hi);
+		lr.val[1] = vminq_f32(vmaxq_f32(vld1q_f32(right + ii), lo), hi);
+		vst2q_f32(out + 2*ii, lr);
+	}
+#endif
+	for (; ii < n; ++ii) {
+		out[2*ii + 0] = _tm_clamp(left[ii], -1.0f, 1.0f);
+		out[2*ii + 1] = _tm_clamp(right[ii], -1.0f, 1.0f);
+	}
+}
+
 static void _tm_addref(buffer_t* buffer) {
 	mt_atomic_increment(&buffer->refcnt);
 }
@@ -116,51 +332,277 @@ static void _tm_decref(buffer_t* buffer) {
 	}
 }
 
+//--queues------------------------------------------------------------------------------------------------
+
+// Free ring entries a command leaves untouched. Parameter updates are resent every frame anyway, so when
+// the mixer falls behind they are dropped first and stops or settings still get through.
+#define RESERVE_UPDATE (N_COMMANDS/2)
+#define RESERVE_ADD (N_COMMANDS/4)
+
+// game thread; never waits for the mixer, returns false if the command was dropped
+static bool _tm_send(const command_t* cmd) {
+	int reserve = 0;
+	if (cmd->type == TM_CMD_SET_POSITION || cmd->type == TM_CMD_SET_GAIN || cmd->type == TM_CMD_SET_FREQUENCY || cmd->type == TM_CMD_LISTENER)
+		reserve = RESERVE_UPDATE;
+	else if (cmd->type == TM_CMD_ADD)
+		reserve = RESERVE_ADD;
+
+	const uint32_t head = (uint32_t)mt_atomic_load(&tm.commands.head);
+	const uint32_t tail = (uint32_t)mt_atomic_load(&tm.commands.tail);
+	if (N_COMMANDS - (head - tail) <= (uint32_t)reserve)
+		return false;
+
+	tm.command_items[head & (N_COMMANDS - 1)] = *cmd;
+	mt_atomic_store(&tm.commands.head, (int32_t)(head + 1));
+	return true;
+}
+
+// mixer thread. Every completion belongs to a distinct add, and the game thread drains completions before
+// each send, so at most N_COMMANDS + max_sources completions can be pending at once.
+static void _tm_post_completion(const source_t* source) {
+	const uint32_t head = (uint32_t)mt_atomic_load(&tm.completions.head);
+	completion_t* c = &tm.completion_items[head & tm.completion_mask];
+	c->buffer = source->buffer;
+	c->instance_data = source->instance_data;
+	c->opaque = source->opaque;
+	c->generation = source->generation;
+	c->slot = (int32_t)(source - tm.sources);
+	mt_atomic_store(&tm.completions.head, (int32_t)(head + 1));
+}
+
+// mixer thread; the buffer reference and the source instance are handed back to the game thread
 static void kill_source(source_t* source) {
+	if (source->buffer)
+		_tm_post_completion(source);
+
+	source->buffer = 0;
+	source->flags = 0;
+}
 
+// game thread; runs channel_complete and releases what the mixer no longer uses
+static void _tm_finish(const completion_t* c) {
 	if (tm.callbacks.channel_complete) {
 		tm_channel channel;
-		channel.index = (int)(source - tm.sources) + 1;
+		channel.index = c->slot + 1;
+		tm.callbacks.channel_complete(tm.callbacks.udata, c->opaque, channel);
+	}
 
-		// unlock the mutex while in the user callback
-		mt_mutex_unlock(&tm.lock);
-		tm.callbacks.channel_complete(tm.callbacks.udata, source->opaque, channel);
-		mt_mutex_lock(&tm.lock);
+	source_t source = {0};
+	source.buffer = c->buffer;
+	source.instance_data = c->instance_data;
+	source.buffer->funcs->end_source(&source);
+	_tm_decref((buffer_t*)c->buffer);
+
+	channel_state_t* state = &tm.channels[c->slot];
+	if (state->generation == c->generation) {
+		state->busy = 0;
+		state->playing = 0;
+		tm.free_slots[tm.nfree++] = c->slot;
 	}
+}
 
-	if (source->buffer) {
-		source->buffer->funcs->end_source(source);
-		_tm_decref((buffer_t*)source->buffer);
+static void _tm_drain_completions(void) {
+	uint32_t tail = (uint32_t)mt_atomic_load(&tm.completions.tail);
+	const uint32_t head = (uint32_t)mt_atomic_load(&tm.completions.head);
+	while (tail != head) {
+		_tm_finish(&tm.completion_items[tail & tm.completion_mask]);
+		++tail;
+	}
+	mt_atomic_store(&tm.completions.tail, (int32_t)tail);
+}
+
+// game thread; pops an idle slot, or steals one when all voices are busy. Stopped sounds go first, then
+// the lowest priority, then the oldest. Looping sounds are never stolen.
+static int find_channel(void) {
+	if (tm.nfree > 0)
+		return tm.free_slots[--tm.nfree];
+
+	int best = -1;
+	bool best_stopped = false;
+	int best_priority = 0;
+	uint32_t best_age = 0;
+
+	for (int ii = 0; ii < tm.max_sources; ++ii) {
+		const channel_state_t* state = &tm.channels[ii];
+		const bool stopped = !state->playing;
+		if (!stopped && state->looping)
+			continue;
+
+		const uint32_t age = tm.start_counter - state->start_order;
+		bool better;
+		if (best < 0 || stopped != best_stopped)
+			better = best < 0 || stopped;
+		else if (state->priority != best_priority)
+			better = state->priority < best_priority;
+		else
+			better = age > best_age;
+
+		if (better) {
+			best = ii;
+			best_stopped = stopped;
+			best_priority = state->priority;
+			best_age = age;
+		}
 	}
+	return best;
+}
 
-	source->buffer = 0;
-	source->flags = 0;
+// game thread; fills in the slot and generation of a command for a live channel
+static bool _tm_channel_command(tm_channel channel, int type, command_t* cmd) {
+	if (channel.index <= 0 || channel.index > tm.max_sources)
+		return false;
+
+	_tm_drain_completions();
+	const channel_state_t* state = &tm.channels[channel.index - 1];
+	if (!state->busy)
+		return false;
+
+	cmd->type = (uint8_t)type;
+	cmd->slot = channel.index - 1;
+	cmd->generation = state->generation;
+	return true;
 }
 
-static source_t* find_source(void) {
-	source_t* best_source = NULL;
-	uint16_t best_age = 0;
+static void _tm_resampler_set_step(tm_resampler* resampler, double ideal_rate);
 
-	for (int ii = 0; ii < N_SOURCES; ++ii) {
-		source_t* source = &tm.sources[ii];
-		if (!source->buffer)
-			return source;
+// the pitch is applied on top of the conversion from the buffer's sample rate
+static void _tm_set_frequency(source_t* source, float frequency, bool reset) {
+	source->frequency = frequency;
+	const double rate = frequency * source->rate_scale;
 
-		if (0 == (source->flags & TM_SOURCEFLAG_LOOPING)) {
-			const uint16_t age = source->frame_age;
-			if (age >= best_age) {
-				best_source = source;
-				best_age = age;
-			}
+	// clear frequency shift if ~0.0f
+	const double diff = rate - 1.0;
+	if (diff*diff < 1.0e-8) {
+		source->flags &= ~TM_SOURCEFLAG_FREQUENCY;
+	} else {
+		if (reset || 0 == (source->flags & TM_SOURCEFLAG_FREQUENCY)) {
+			const int quality = source->resampler.quality;
+			tm_resampler_init_rate(&source->resampler, (float)rate);
+			source->resampler.quality = quality;
 		}
+		// the step is derived in double, a float ratio drifts audibly over long loops
+		_tm_resampler_set_step(&source->resampler, rate);
+		source->flags |= TM_SOURCEFLAG_FREQUENCY;
 	}
+}
 
-	if (NULL != best_source) {
-		if (best_source->buffer) {
-			kill_source(best_source);
+static void _tm_set_listener(const float* position, const float* forward) {
+	_tm_vcopy(tm.position, position);
+	_tm_vcopy(tm.forward, forward);
+	// Compute right vector: cross(forward, up) where up = (0, 1, 0)
+	// right = (-forward.z, 0, forward.x)
+	float rx = -forward[2];
+	float rz = forward[0];
+	// Normalize the right vector (only x and z components, y is always 0)
+	float len = sqrtf(rx * rx + rz * rz);
+	if (len > 1.0e-8f) {
+		tm.right[0] = rx / len;
+		tm.right[1] = 0.0f;
+		tm.right[2] = rz / len;
+	} else {
+		// Fallback if forward is pointing straight up/down
+		tm.right[0] = 1.0f;
+		tm.right[1] = 0.0f;
+		tm.right[2] = 0.0f;
+	}
+}
+
+static void _tm_set_compressor(const float* args) {
+	tm.compressor_thresholds[0] = args[0];
+	tm.compressor_thresholds[1] = args[1];
+	tm.compressor_multipliers[0] = args[2];
+	tm.compressor_multipliers[1] = args[3];
+	tm.compressor_attack_per1ksamples = args[4];
+	tm.compressor_release_per1ksamples = args[5];
+}
+
+// mixer thread
+static void run_command(const command_t* cmd) {
+	source_t* source = (cmd->slot >= 0) ? &tm.sources[cmd->slot] : NULL;
+
+	if (cmd->type == TM_CMD_ADD) {
+		// the game thread reused the slot, the previous sound is stolen
+		if (source->buffer)
+			kill_source(source);
+
+		source->buffer = cmd->buffer;
+		source->instance_data = cmd->instance_data;
+		source->generation = cmd->generation;
+		source->opaque = NULL;
+		source->gain_base = cmd->args[0];
+		source->gain_base_index = cmd->gain_index;
+		source->flags = cmd->flags | TM_SOURCEFLAG_PLAYING;
+		source->rate_scale = cmd->buffer->sample_rate ? (double)cmd->buffer->sample_rate / (double)tm.sample_rate : 1.0;
+		source->resampler.quality = TM_RESAMPLE_CUBIC;
+		_tm_set_frequency(source, cmd->args[1], true);
+		if (cmd->flags & TM_SOURCEFLAG_POSITIONAL) {
+			_tm_vcopy(source->position, &cmd->args[2]);
+			source->distance_min = cmd->args[5];
+			source->distance_difference = cmd->args[6] - cmd->args[5];
+		}
+		return;
+	}
+
+	// commands for sounds that already finished or were replaced are stale
+	if (source && (!source->buffer || source->generation != cmd->generation))
+		return;
+
+	switch (cmd->type) {
+	case TM_CMD_STOP:
+		kill_source(source);
+		break;
+	case TM_CMD_SET_OPAQUE:
+		source->opaque = cmd->opaque;
+		break;
+	case TM_CMD_SET_POSITION:
+		_tm_vcopy(source->position, cmd->args);
+		break;
+	case TM_CMD_FADEOUT:
+		source->fadeout_per_sample = cmd->args[0];
+		source->flags |= TM_SOURCEFLAG_FADEOUT;
+		break;
+	case TM_CMD_SET_GAIN:
+		source->gain_base = cmd->args[0];
+		source->flags &= ~TM_SOURCEFLAG_FADEOUT;
+		break;
+	case TM_CMD_SET_FREQUENCY:
+		_tm_set_frequency(source, cmd->args[0], false);
+		break;
+	case TM_CMD_SET_RESAMPLER:
+		source->resampler.quality = cmd->gain_index;
+		break;
+	case TM_CMD_STOP_ALL:
+		for (int ii = 0; ii < tm.max_sources; ++ii) {
+			if (tm.sources[ii].buffer)
+				kill_source(&tm.sources[ii]);
 		}
+		break;
+	case TM_CMD_MASTER_GAIN:
+		tm.gain_master = cmd->args[0];
+		break;
+	case TM_CMD_BASE_GAIN:
+		tm.gain_base[cmd->gain_index] = cmd->args[0];
+		break;
+	case TM_CMD_CALLBACK_GAIN:
+		tm.gain_callback = cmd->args[0];
+		break;
+	case TM_CMD_LISTENER:
+		_tm_set_listener(&cmd->args[0], &cmd->args[3]);
+		break;
+	case TM_CMD_COMPRESSOR:
+		_tm_set_compressor(cmd->args);
+		break;
 	}
-	return best_source;
+}
+
+static void run_commands(void) {
+	uint32_t tail = (uint32_t)mt_atomic_load(&tm.commands.tail);
+	const uint32_t head = (uint32_t)mt_atomic_load(&tm.commands.head);
+	while (tail != head) {
+		run_command(&tm.command_items[tail & (N_COMMANDS - 1)]);
+		++tail;
+	}
+	mt_atomic_store(&tm.commands.tail, (int32_t)tail);
 }
 
 static void render(source_t* source, float* buffer, const float gain[2]) {
@@ -179,23 +621,31 @@ static void render(source_t* source, float* buffer, const float gain[2]) {
 		// source has a non-1.0f frequency shift
 		if (source->flags & TM_SOURCEFLAG_FREQUENCY) {
 			samples_read = tm_resampler_calculate_input_samples(&source->resampler, samples_read);
-			samples_read = source->buffer->funcs->request_samples(source, &srcleft, &srcright, samples_read);
-			if (samples_read == 0) {
-				// source is no longer playing
-				source->flags &= ~TM_SOURCEFLAG_PLAYING;
-				return;
+			if (samples_read > 0) {
+				samples_read = source->buffer->funcs->request_samples(source, &srcleft, &srcright, samples_read);
+				if (samples_read == 0) {
+					// source is no longer playing
+					source->flags &= ~TM_SOURCEFLAG_PLAYING;
+					return;
+				}
+				if (srcleft != srcright)
+					source->flags |= TM_SOURCEFLAG_STEREO;
+				else
+					source->flags &= ~TM_SOURCEFLAG_STEREO;
+			} else {
+				// the resampler history covers the next outputs
+				srcleft = NULL;
+				srcright = (source->flags & TM_SOURCEFLAG_STEREO) ? tm.scratch : NULL;
 			}
 
-			samples_written = tm_resampler_calculate_output_samples(&source->resampler, samples_read);
-			tm_resample_mono(&source->resampler, srcleft, samples_read, tm.scratch, samples_written);
-
+			samples_written = _tm_min(tm_resampler_calculate_output_samples(&source->resampler, samples_read), remaining);
 			if (srcleft == srcright) {
+				tm_resample_mono(&source->resampler, srcleft, samples_read, tm.scratch, samples_written);
 				srcleft = tm.scratch;
 				srcright = tm.scratch;
 			} else {
-				// resmample the second streo channel
-				tm_resample_mono(&source->resampler, srcright, samples_read, tm.scratch + samples_written, samples_written);
-
+				// both stereo channels share one phase
+				tm_resample_planar(&source->resampler, srcleft, srcright, samples_read, tm.scratch, tm.scratch + samples_written, samples_written);
 				srcleft = tm.scratch;
 				srcright = tm.scratch + samples_written;
 			}
@@ -210,10 +660,10 @@ static void render(source_t* source, float* buffer, const float gain[2]) {
 		}
 
 		// render the source to the output mix
-		for (int ii = 0; ii < samples_written; ++ii)
-			*left++ += gain[0] * srcleft[ii];
-		for (int ii = 0; ii < samples_written; ++ii)
-			*right++ += gain[1] * srcright[ii];
+		_tm_mix_gain(left, srcleft, gain[0], samples_written);
+		_tm_mix_gain(right, srcright, gain[1], samples_written);
+		left += samples_written;
+		right += samples_written;
 
 		remaining -= samples_written;
 	}
@@ -223,12 +673,7 @@ static void render_effects(float* buffer) {
 	float compressor_factor = tm.compressor_factor;
 
 	// get maximum absolute power level from the rendered buffer, and adjust the compressor factor
-	float max_power = 0;
-	for (int ii = 0; ii < N_SAMPLES; ++ii) {
-		const float power = fabsf(buffer[ii]);
-		if (power > max_power)
-			max_power = power;
-	}
+	const float max_power = _tm_abs_max(buffer, N_SAMPLES);
 
 	float target_compressor_factor = 1.0f;
 	if (max_power > tm.compressor_thresholds[1])
@@ -271,12 +716,14 @@ static void render_effects(float* buffer) {
 }
 
 static void mix(float* buffer) {
+	run_commands();
+
 	int nplaying = 0;
-	int playing[N_SOURCES];
-	float gain[N_SOURCES][2];
+	int32_t* playing = tm.playing;
+	float (*gain)[2] = tm.gains;
 
 	// build active sounds
-	for (int ii = 0; ii < N_SOURCES; ++ii) {
+	for (int ii = 0; ii < tm.max_sources; ++ii) {
 		const source_t* source = &tm.sources[ii];
 		if (source->flags & TM_SOURCEFLAG_PLAYING) {
 			playing[nplaying] = ii;
@@ -339,7 +786,6 @@ static void mix(float* buffer) {
 	// perform source-level post processing
 	for (int ii = 0; ii < nplaying; ++ii) {
 		source_t* source = &tm.sources[playing[ii]];
-		++source->frame_age;
 
 		// handle fadeout->stop
 		if (source->flags & TM_SOURCEFLAG_FADEOUT) {
@@ -360,7 +806,11 @@ static void mix(float* buffer) {
 }
 
 void tm_getsamples(float* samples, int nsamples) {
-	mt_mutex_lock(&tm.lock);
+	// the device may already be pulling samples before tm_init, or after tm_shutdown
+	if (!mt_atomic_load(&tm.running)) {
+		memset(samples, 0, sizeof(float)*2*nsamples);
+		return;
+	}
 
 	// was data leftover after the previous call to getsamples? Copy that out here
 	while (nsamples && tm.samples_remaining) {
@@ -368,9 +818,7 @@ void tm_getsamples(float* samples, int nsamples) {
 		const int offset = N_SAMPLES - tm.samples_remaining;
 
 		// clip and interleave
-		for (int cc = 0; cc < 2; ++cc)
-			for (int ii = 0; ii < samples_to_mix; ++ii)
-				samples[cc + 2*ii] = _tm_clamp(tm.buffer[cc*N_SAMPLES + offset + ii], -1.0f, 1.0f);
+		_tm_clip_interleave(samples, tm.buffer + offset, tm.buffer + N_SAMPLES + offset, samples_to_mix);
 
 		tm.samples_remaining -= samples_to_mix;
 		samples += (2*samples_to_mix);
@@ -384,51 +832,69 @@ void tm_getsamples(float* samples, int nsamples) {
 		tm.samples_remaining = N_SAMPLES;
 
 		// clip and interleave
-		for (int cc = 0; cc < 2; ++cc)
-			for (int ii = 0; ii < samples_to_mix; ++ii)
-				samples[cc + 2*ii] = _tm_clamp(tm.buffer[cc*N_SAMPLES + ii], -1.0f, 1.0f);
-
+		_tm_clip_interleave(samples, tm.buffer, tm.buffer + N_SAMPLES, samples_to_mix);
 
 		tm.samples_remaining -= samples_to_mix;
 		samples += (2*samples_to_mix);
 		nsamples -= samples_to_mix;
 	}
-
-	mt_mutex_unlock(&tm.lock);
 }
 
 void tm_set_mastergain(float gain) {
-	mt_mutex_lock(&tm.lock);
-	tm.gain_master = gain;
-	mt_mutex_unlock(&tm.lock);
-}
-
-static source_t* add(const tm_buffer* handle, int gain_index, float gain, float pitch) {
-	source_t* source = find_source();
-	if (!source)
-		return 0;
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_MASTER_GAIN;
+	cmd.slot = -1;
+	cmd.args[0] = gain;
+	_tm_send(&cmd);
+}
+
+// game thread; the source instance is started here so the mixer never allocates
+static bool add(const tm_buffer* handle, int gain_index, float gain, float pitch, uint8_t flags, const float* position, float distance_min, float distance_max, tm_channel* channel) {
+	_tm_drain_completions();
+
+	channel->index = 0;
+	const int slot = find_channel();
+	if (slot < 0)
+		return false;
+
+	channel_state_t* state = &tm.channels[slot];
+	command_t cmd = {0};
+	cmd.type = TM_CMD_ADD;
+	cmd.flags = flags;
+	cmd.gain_index = (uint8_t)gain_index;
+	cmd.slot = slot;
+	cmd.generation = state->generation + 1;
+	cmd.buffer = (const buffer_t*)handle;
+	cmd.args[0] = gain;
+	cmd.args[1] = pitch;
+	if (position) {
+		_tm_vcopy(&cmd.args[2], position);
+		cmd.args[5] = distance_min;
+		cmd.args[6] = distance_max;
+	}
 
-	source->buffer = (const buffer_t*)handle;
-	source->gain_base = gain;
-	source->gain_base_index = (uint8_t)gain_index;
-	source->frame_age = 0;
+	source_t source = {0};
+	source.buffer = cmd.buffer;
+	source.flags = flags;
+	source.buffer->funcs->start_source(&source);
+	cmd.instance_data = source.instance_data;
 
-	const float diff = pitch - 1.0f;
-	if (diff*diff < 1.0e-8f) {
-		source->flags &= ~TM_SOURCEFLAG_FREQUENCY;
-	} else {
-		source->flags |= TM_SOURCEFLAG_FREQUENCY;
-		tm_resampler_init_rate(&source->resampler, pitch);
+	if (!_tm_send(&cmd)) {
+		source.buffer->funcs->end_source(&source);
+		return false;
 	}
 
-	source->buffer->funcs->start_source(source);
-
 	_tm_addref((buffer_t*)handle);
-	return source;
-}
-
-static void play(source_t* source) {
-	source->flags |= TM_SOURCEFLAG_PLAYING;
+	state->generation = cmd.generation;
+	state->start_order = tm.start_counter++;
+	state->gain = gain;
+	state->priority = 0;
+	state->busy = 1;
+	state->playing = 1;
+	state->looping = (flags & TM_SOURCEFLAG_LOOPING) != 0;
+	channel->index = slot + 1;
+	return true;
 }
 
 typedef struct {
@@ -492,9 +958,10 @@ static buffer_functions_t static_sample_functions = {
 void tm_create_buffer_interleaved_s16le(int channels, const int16_t* pcm_data, int pcm_data_size, const tm_buffer** handle) {
 	const int nsamples = pcm_data_size/sizeof(uint16_t)/channels;
 
-	static_sample_buffer* buffer = (static_sample_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(buffer_t) + nsamples*channels*sizeof(float));
+	static_sample_buffer* buffer = (static_sample_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(static_sample_buffer) + nsamples*channels*sizeof(float));
 	buffer->buffer.funcs = &static_sample_functions;
 	buffer->buffer.refcnt = 1;
+	buffer->buffer.sample_rate = 0;
 	buffer->nchannels = (uint8_t)channels;
 	buffer->nsamples = nsamples;
 
@@ -512,9 +979,10 @@ void tm_create_buffer_interleaved_s16le(int channels, const int16_t* pcm_data, i
 void tm_create_buffer_interleaved_float(int channels, const float* pcm_data, int pcm_data_size, const tm_buffer** handle) {
 	const int nsamples = pcm_data_size/sizeof(float)/channels;
 
-	static_sample_buffer* buffer = (static_sample_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(buffer_t) + nsamples*channels*sizeof(float));
+	static_sample_buffer* buffer = (static_sample_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(static_sample_buffer) + nsamples*channels*sizeof(float));
 	buffer->buffer.funcs = &static_sample_functions;
 	buffer->buffer.refcnt = 1;
+	buffer->buffer.sample_rate = 0;
 	buffer->nchannels = (uint8_t)channels;
 	buffer->nsamples = nsamples;
 
@@ -543,57 +1011,165 @@ static void vorbis_stream_on_destroy(buffer_t* buffer) {
 		vbuffer->closed(vbuffer->opaque);
 }
 
+// Copies decoded frames into the ring, decoding at most one vorbis frame. Returns false if the
+// stream is full or finished. Called from the decoder thread, or the game thread before the stream is shared.
+static bool _tm_vorbis_fill(vorbis_stream_t* stream) {
+	if (stream->noutputs == 0) {
+		if (mt_atomic_load(&stream->finished))
+			return false;
+
+		const uint32_t space = N_STREAM_FRAMES - ((uint32_t)mt_atomic_load(&stream->write) - (uint32_t)mt_atomic_load(&stream->read));
+		if (space == 0)
+			return false;
+
+		int channels;
+		float** outputs;
+		stream->noutputs = stb_vorbis_get_frame_float(stream->v, &channels, &outputs);
+
+		// if we're looping and have reached the end, seek to the start and try again
+		if (stream->noutputs == 0 && stream->looping) {
+			stb_vorbis_seek_start(stream->v);
+			stream->noutputs = stb_vorbis_get_frame_float(stream->v, &channels, &outputs);
+		}
+
+		if (stream->noutputs == 0) {
+			mt_atomic_store(&stream->finished, 1);
+			return false;
+		}
+
+		// handle mono streams
+		stream->outputs[0] = outputs[0];
+		stream->outputs[1] = (channels == 1) ? outputs[0] : outputs[1];
+	}
+
+	bool progress = false;
+	while (stream->noutputs > 0) {
+		const uint32_t write = (uint32_t)mt_atomic_load(&stream->write);
+		const uint32_t space = N_STREAM_FRAMES - (write - (uint32_t)mt_atomic_load(&stream->read));
+		const uint32_t offset = write & (N_STREAM_FRAMES - 1);
+		const int n = _tm_min(_tm_min(stream->noutputs, (int)space), (int)(N_STREAM_FRAMES - offset));
+		if (n == 0)
+			break;
+
+		memcpy(stream->pcm[0] + offset, stream->outputs[0], sizeof(float)*n);
+		if (stream->pcm[1] != stream->pcm[0])
+			memcpy(stream->pcm[1] + offset, stream->outputs[1], sizeof(float)*n);
+
+		stream->outputs[0] += n;
+		stream->outputs[1] += n;
+		stream->noutputs -= n;
+		mt_atomic_store(&stream->write, (int32_t)(write + n));
+		progress = true;
+	}
+	return progress;
+}
+
+static void* _tm_decoder_main(void* arg) {
+	(void)arg;
+	while (mt_atomic_load(&tm.decoder_running)) {
+		// one vorbis frame per stream and pass, so starting or ending a stream never waits long for the lock
+		bool busy = false;
+		mt_mutex_lock(&tm.decoder_lock);
+		for (vorbis_stream_t* stream = tm.streams; stream; stream = stream->next)
+			busy |= _tm_vorbis_fill(stream);
+
+		// all rings are full or finished. The mixer signals without the lock, so a wake between the
+		// pass and the wait is missed, the next mix block wakes the decoder before the rings run dry.
+		if (!busy && mt_atomic_load(&tm.decoder_running)) {
+			mt_atomic_store(&tm.decoder_idle, 1);
+			mt_cond_wait(&tm.decoder_wake, &tm.decoder_lock);
+			mt_atomic_store(&tm.decoder_idle, 0);
+		}
+		mt_mutex_unlock(&tm.decoder_lock);
+	}
+	return NULL;
+}
+
+// game thread
 static void vorbis_stream_start_source(source_t* source) {
 	const vorbis_stream_buffer* vbuffer = (const vorbis_stream_buffer*)source->buffer;
-	vorbis_stream_data_t* vsd = &source->instance_data.vorbis_stream;
+	source->instance_data.vorbis_stream.stream = NULL;
 
 	// open the vorbis stream
 	unsigned char* data = (unsigned char*)(vbuffer + 1);
-	vsd->v = stb_vorbis_open_memory(data, vbuffer->ndata, NULL, NULL);
-	vsd->noutputs = 0;
+	stb_vorbis* v = stb_vorbis_open_memory(data, vbuffer->ndata, NULL, NULL);
+	if (!v)
+		return;
+
+	const int nrings = (stb_vorbis_get_info(v).channels == 1) ? 1 : 2;
+	vorbis_stream_t* stream = (vorbis_stream_t*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(vorbis_stream_t) + nrings*N_STREAM_FRAMES*sizeof(float));
+	memset(stream, 0, sizeof(vorbis_stream_t));
+	stream->v = v;
+	stream->pcm[0] = (float*)(stream + 1);
+	stream->pcm[1] = stream->pcm[0] + (nrings - 1)*N_STREAM_FRAMES;
+	stream->looping = (source->flags & TM_SOURCEFLAG_LOOPING) != 0;
+
+	// prefetch the first mix block here, so playback doesn't start with an underrun
+	while (mt_atomic_load(&stream->write) < N_SAMPLES && _tm_vorbis_fill(stream)) {}
+
+	mt_mutex_lock(&tm.decoder_lock);
+	stream->next = tm.streams;
+	tm.streams = stream;
+	mt_cond_signal(&tm.decoder_wake);
+	mt_mutex_unlock(&tm.decoder_lock);
+
+	source->instance_data.vorbis_stream.stream = stream;
 }
 
+// game thread, the mixer is done with the source
 static void vorbis_stream_end_source(source_t* source) {
-	stb_vorbis* v = source->instance_data.vorbis_stream.v;
-	if (v)
-		stb_vorbis_close(v);
+	vorbis_stream_t* stream = source->instance_data.vorbis_stream.stream;
+	if (!stream)
+		return;
+
+	mt_mutex_lock(&tm.decoder_lock);
+	vorbis_stream_t** link = &tm.streams;
+	while (*link != stream)
+		link = &(*link)->next;
+	*link = stream->next;
+	mt_mutex_unlock(&tm.decoder_lock);
 
-	source->instance_data.vorbis_stream.v = 0;
+	stb_vorbis_close(stream->v);
+	tm.callbacks.free(tm.callbacks.udata, stream);
+	source->instance_data.vorbis_stream.stream = NULL;
 }
 
+static const float _tm_silence[N_SAMPLES];
+
+// mixer thread, only consumes frames the decoder already produced
 static int vorbis_stream_request_samples(source_t* source, const float** left, const float** right, int nsamples) {
-	vorbis_stream_data_t* vsd = &source->instance_data.vorbis_stream;
+	vorbis_stream_t* stream = source->instance_data.vorbis_stream.stream;
 
 	// no steam?
-	if (!vsd->v)
+	if (!stream)
 		return 0;
 
-	if (vsd->noutputs == 0) {
-		int channels;
-		float** outputs;
-		vsd->noutputs = stb_vorbis_get_frame_float(vsd->v, &channels, &outputs);
+	// the frames handed out last time are rendered now, the decoder may reuse them
+	uint32_t read = (uint32_t)mt_atomic_load(&stream->read) + stream->pending;
+	mt_atomic_store(&stream->read, (int32_t)read);
+	if (stream->pending > 0 && mt_atomic_load(&tm.decoder_idle))
+		mt_cond_signal(&tm.decoder_wake);
+	stream->pending = 0;
 
-		// if we're looping and have reached the end, seek to the start and try again
-		if (vsd->noutputs == 0 && source->flags & TM_SOURCEFLAG_LOOPING) {
-			stb_vorbis_seek_start(vsd->v);
-			vsd->noutputs = stb_vorbis_get_frame_float(vsd->v, &channels, &outputs);
-		}
+	const uint32_t available = (uint32_t)mt_atomic_load(&stream->write) - read;
+	if (available == 0) {
+		if (mt_atomic_load(&stream->finished))
+			return 0;
 
-		// handle mono streams
-		if (vsd->noutputs) {
-			vsd->outputs[0] = outputs[0];
-			vsd->outputs[1] = (channels == 1) ? outputs[0] : outputs[1];
-		}
+		// the decoder fell behind, play silence rather than stopping the source
+		if (mt_atomic_load(&tm.decoder_idle))
+			mt_cond_signal(&tm.decoder_wake);
+		*left = _tm_silence;
+		*right = _tm_silence;
+		return _tm_min(nsamples, N_SAMPLES);
 	}
 
-	nsamples = _tm_min(nsamples, vsd->noutputs);
+	const uint32_t offset = read & (N_STREAM_FRAMES - 1);
+	nsamples = _tm_min(_tm_min(nsamples, (int)available), (int)(N_STREAM_FRAMES - offset));
 
-	*left = vsd->outputs[0];
-	*right = vsd->outputs[1];
-
-	vsd->noutputs -= nsamples;
-	vsd->outputs[0] += nsamples;
-	vsd->outputs[1] += nsamples;
+	*left = stream->pcm[0] + offset;
+	*right = stream->pcm[1] + offset;
+	stream->pending = nsamples;
 	return nsamples;
 }
 
@@ -611,18 +1187,65 @@ static buffer_functions_t vorbis_stream_buffer_funcs = {
 };
 
 void tm_create_buffer_vorbis_stream(const void* data, int ndata, void* opaque, void (*closed)(void*), const tm_buffer** handle) {
-	mt_mutex_lock(&tm.lock);
 	vorbis_stream_buffer* buffer = (vorbis_stream_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(vorbis_stream_buffer) + ndata);
 	buffer->buffer.funcs = &vorbis_stream_buffer_funcs;
 	buffer->buffer.refcnt = 1;
+	buffer->buffer.sample_rate = 0;
 	buffer->opaque = opaque;
 	buffer->closed = closed;
 	buffer->ndata = ndata;
 
+	// read the native sample rate once, sources are converted to the mixer rate
+	stb_vorbis* v = stb_vorbis_open_memory((const unsigned char*)data, ndata, NULL, NULL);
+	if (v) {
+		buffer->buffer.sample_rate = (int32_t)stb_vorbis_get_info(v).sample_rate;
+		stb_vorbis_close(v);
+	}
+
 	// copy vorbis data
 	memcpy(buffer + 1, data, ndata);
 	*handle = (tm_buffer*)buffer;
-	mt_mutex_unlock(&tm.lock);
+}
+
+void tm_create_buffer_vorbis_decoded(const void* data, int ndata, const tm_buffer** handle) {
+	*handle = NULL;
+	stb_vorbis* v = stb_vorbis_open_memory((const unsigned char*)data, ndata, NULL, NULL);
+	if (!v)
+		return;
+
+	// decode straight into a static buffer, extra channels beyond stereo are dropped
+	const stb_vorbis_info info = stb_vorbis_get_info(v);
+	const int channels = (info.channels == 1) ? 1 : 2;
+	const int nsamples = (int)stb_vorbis_stream_length_in_samples(v);
+	static_sample_buffer* buffer = (static_sample_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(static_sample_buffer) + nsamples*channels*sizeof(float));
+	buffer->buffer.funcs = &static_sample_functions;
+	buffer->buffer.refcnt = 1;
+	buffer->buffer.sample_rate = (int32_t)info.sample_rate;
+	buffer->nchannels = (uint8_t)channels;
+
+	float* dest = (float*)(buffer + 1);
+	int decoded = 0;
+	while (decoded < nsamples) {
+		int frame_channels;
+		float** outputs;
+		int n = stb_vorbis_get_frame_float(v, &frame_channels, &outputs);
+		if (n == 0)
+			break;
+
+		n = _tm_min(n, nsamples - decoded);
+		memcpy(dest + decoded, outputs[0], sizeof(float)*n);
+		if (channels == 2)
+			memcpy(dest + nsamples + decoded, outputs[1], sizeof(float)*n);
+		decoded += n;
+	}
+	stb_vorbis_close(v);
+
+	// the right channel starts at nsamples, so a short decode moves it down
+	if (channels == 2 && decoded < nsamples)
+		memmove(dest + decoded, dest + nsamples, sizeof(float)*decoded);
+	buffer->nsamples = decoded;
+
+	*handle = (tm_buffer*)buffer;
 }
 
 typedef struct {
@@ -664,170 +1287,121 @@ static buffer_functions_t custom_stream_buffer_funcs = {
 };
 
 void tm_create_buffer_custom_stream(void* opaque, tm_buffer_callbacks callbacks, const tm_buffer** handle) {
-	mt_mutex_lock(&tm.lock);
 	custom_stream_buffer* buffer = (custom_stream_buffer*)tm.callbacks.allocate(tm.callbacks.udata, sizeof(custom_stream_buffer));
 	buffer->buffer.funcs = &custom_stream_buffer_funcs;
 	buffer->buffer.refcnt = 1;
+	buffer->buffer.sample_rate = 0;
 	buffer->opaque = opaque;
 	buffer->callbacks = callbacks;
 
 	*handle = (tm_buffer*)buffer;
-	mt_mutex_unlock(&tm.lock);
+}
+
+void tm_buffer_set_sample_rate(const tm_buffer* handle, int sample_rate) {
+	((buffer_t*)handle)->sample_rate = sample_rate;
 }
 
 int tm_get_buffer_size(const tm_buffer* handle) {
-	mt_mutex_lock(&tm.lock);
 	const buffer_t* buffer = (const buffer_t*)handle;
-	int size = buffer->funcs->get_buffer_size(buffer);
-	mt_mutex_unlock(&tm.lock);
-	return size;
+	return buffer->funcs->get_buffer_size(buffer);
 }
 
 void tm_release_buffer(const tm_buffer* handle) {
-	mt_mutex_lock(&tm.lock);
+	// playing sources hold their own reference until their completion is drained
+	_tm_drain_completions();
 	_tm_decref((buffer_t*)handle);
-	mt_mutex_unlock(&tm.lock);
 }
 
 bool tm_add(const tm_buffer* handle, int gain_index, float gain, float pitch, tm_channel* channel) {
-    mt_mutex_lock(&tm.lock);
-    source_t* source = add(handle, gain_index, gain, pitch);
-    if (source) {
-        play(source);
-        channel->index = (int)(source - tm.sources) + 1;
-        mt_mutex_unlock(&tm.lock);
-        return true;
-    }
-    mt_mutex_unlock(&tm.lock);
-    return false;
+	return add(handle, gain_index, gain, pitch, 0, NULL, 0.0f, 0.0f, channel);
 }
 
 bool tm_add_spatial(const tm_buffer* handle, int gain_index, float gain, float pitch, const float* position, float distance_min, float distance_max, tm_channel* channel) {
-    mt_mutex_lock(&tm.lock);
-	source_t *source = add(handle, gain_index, gain, pitch);
-	if (source) {
-		_tm_vcopy(source->position, position);
-		source->flags |= TM_SOURCEFLAG_POSITIONAL;
-		source->distance_min = distance_min;
-		source->distance_difference = (distance_max - distance_min);
-		play(source);
-		channel->index = (int)(source - tm.sources) + 1;
-        mt_mutex_unlock(&tm.lock);
-		return true;
-	}
-    mt_mutex_unlock(&tm.lock);
-	return false;
-}
-
-
-static source_t* _add_loop(const tm_buffer* handle, int gain_index, float gain, float pitch, tm_channel* channel) {
-	source_t* source = add(handle, gain_index, gain, pitch);
-	if (!source) {
-		channel->index = 0;
-		return 0;
-	}
-
-	source->flags |= TM_SOURCEFLAG_LOOPING;
-	channel->index = (int)(source - tm.sources) + 1;
-	return source;
+	return add(handle, gain_index, gain, pitch, TM_SOURCEFLAG_POSITIONAL, position, distance_min, distance_max, channel);
 }
 
 bool tm_add_loop(const tm_buffer* handle, int gain_index, float gain, float pitch, tm_channel* channel) {
-    mt_mutex_lock(&tm.lock);
-    source_t* source = _add_loop(handle, gain_index, gain, pitch, channel);
-    if (source) {
-        play(source);
-        mt_mutex_unlock(&tm.lock);
-        return true;
-    }
-    mt_mutex_unlock(&tm.lock);
-    return false;
+	return add(handle, gain_index, gain, pitch, TM_SOURCEFLAG_LOOPING, NULL, 0.0f, 0.0f, channel);
 }
 
 bool tm_add_spatial_loop(const tm_buffer* handle, int gain_index, float gain, float pitch, const float* position, float distance_min, float distance_max, tm_channel* channel) {
-    mt_mutex_lock(&tm.lock);
-	source_t* source = _add_loop(handle, gain_index, gain, pitch, channel);
-	if (source) {
-		_tm_vcopy(source->position, position);
-		source->flags |= TM_SOURCEFLAG_POSITIONAL;
-		source->distance_min = distance_min;
-		source->distance_difference = (distance_max - distance_min);
-
-		play(source);
-        mt_mutex_unlock(&tm.lock);
-		return true;
-	}
-    mt_mutex_unlock(&tm.lock);
-	return false;
+	return add(handle, gain_index, gain, pitch, TM_SOURCEFLAG_POSITIONAL | TM_SOURCEFLAG_LOOPING, position, distance_min, distance_max, channel);
 }
 
 void tm_channel_set_opaque(tm_channel channel, void* opaque) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	source->opaque = opaque;
-	mt_mutex_unlock(&tm.lock);
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_SET_OPAQUE, &cmd)) {
+		cmd.opaque = opaque;
+		_tm_send(&cmd);
+	}
 }
 
 bool tm_channel_isplaying(tm_channel channel) {
-	if (channel.index == 0) return false;
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	bool playing = (source->flags & TM_SOURCEFLAG_PLAYING) != 0;
-	mt_mutex_unlock(&tm.lock);
-	return playing;
+	if (channel.index <= 0 || channel.index > tm.max_sources) return false;
+	_tm_drain_completions();
+	return tm.channels[channel.index - 1].playing != 0;
 }
 
 void tm_channel_stop(tm_channel channel) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	kill_source(source);
-	mt_mutex_unlock(&tm.lock);
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_STOP, &cmd) && _tm_send(&cmd))
+		tm.channels[cmd.slot].playing = 0;
 }
 
 void tm_channel_set_position(tm_channel channel, const float* position) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	_tm_vcopy(source->position, position);
-	mt_mutex_unlock(&tm.lock);
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_SET_POSITION, &cmd)) {
+		_tm_vcopy(cmd.args, position);
+		_tm_send(&cmd);
+	}
 }
 
 void tm_channel_fadeout(tm_channel channel, float seconds) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	source->fadeout_per_sample = 1.0f / (seconds * tm.sample_rate);
-	source->flags |= TM_SOURCEFLAG_FADEOUT;
-	mt_mutex_unlock(&tm.lock);
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_FADEOUT, &cmd)) {
+		cmd.args[0] = 1.0f / (seconds * tm.sample_rate);
+		_tm_send(&cmd);
+	}
 }
 
 void tm_channel_set_gain(tm_channel channel, float gain) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	source->gain_base = gain;
-	source->flags &= ~TM_SOURCEFLAG_FADEOUT;
-	mt_mutex_unlock(&tm.lock);
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_SET_GAIN, &cmd)) {
+		cmd.args[0] = gain;
+		if (_tm_send(&cmd))
+			tm.channels[cmd.slot].gain = gain;
+	}
 }
 
+// the gain last set from the game thread, fadeouts are not reflected
 float tm_channel_get_gain(tm_channel channel) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
-	float g = source->gain_base;
-	mt_mutex_unlock(&tm.lock);
-	return g;
+	if (channel.index <= 0 || channel.index > tm.max_sources) return 0.0f;
+	return tm.channels[channel.index - 1].gain;
 }
 
 void tm_channel_set_frequency(tm_channel channel, float frequency) {
-	mt_mutex_lock(&tm.lock);
-	source_t* source = &tm.sources[channel.index - 1];
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_SET_FREQUENCY, &cmd)) {
+		cmd.args[0] = frequency;
+		_tm_send(&cmd);
+	}
+}
 
-	// clear frequency shift if ~0.0f
-	const float diff = frequency - 1.0f;
-	if (diff*diff < 1.0e-8f) {
-		source->flags &= ~TM_SOURCEFLAG_FREQUENCY;
-	} else {
-		source->flags |= TM_SOURCEFLAG_FREQUENCY;
-		source->resampler.ideal_rate = frequency;
+void tm_channel_set_resampler(tm_channel channel, tm_resample_quality quality) {
+	command_t cmd = {0};
+	if (_tm_channel_command(channel, TM_CMD_SET_RESAMPLER, &cmd)) {
+		cmd.gain_index = (uint8_t)quality;
+		_tm_send(&cmd);
 	}
-	mt_mutex_unlock(&tm.lock);
+}
+
+void tm_channel_set_priority(tm_channel channel, int priority) {
+	if (channel.index <= 0 || channel.index > tm.max_sources) return;
+	tm.channels[channel.index - 1].priority = priority;
+}
+
+void tm_update(void) {
+	_tm_drain_completions();
 }
 
 static void* _tm_default_allocate(void* opaque, int bytes) {
@@ -838,7 +1412,51 @@ static void _tm_default_free(void* opaque, void* ptr) {
     free(ptr);
 }
 
-void tm_init(tm_callbacks callbacks, int sample_rate) {
+static void _tm_compressor_args(const float thresholds[2], const float multipliers[2], float attack_seconds, float release_seconds, float* args) {
+	args[0] = _tm_clamp(thresholds[0], 0.0f, 1.0f);
+	args[1] = _tm_clamp(thresholds[1], 0.0f, 1.0f);
+	args[2] = _tm_clamp(multipliers[0], 0.0f, 1.0f);
+	args[3] = _tm_clamp(multipliers[1], 0.0f, 1.0f);
+
+    float attackSampleRate = (attack_seconds * (float)tm.sample_rate);
+	args[4] = (attackSampleRate > 0.0f) ? (1.0f / attackSampleRate) : 1.0f;
+
+    float releaseSampleRate = (release_seconds * (float)tm.sample_rate);
+	args[5] = (releaseSampleRate > 0.0f) ? (1.0f / releaseSampleRate) : 1.0f;
+}
+
+static void _tm_create_pool(int max_sources) {
+	// the completion ring must hold N_COMMANDS + max_sources entries, see _tm_post_completion
+	uint32_t ncompletions = 1;
+	while (ncompletions < (uint32_t)(N_COMMANDS + max_sources))
+		ncompletions <<= 1;
+
+	// pointer sized members first, so every array stays aligned
+	const size_t size_completions = sizeof(completion_t)*ncompletions;
+	const size_t size_sources = sizeof(source_t)*max_sources;
+	const size_t size_channels = sizeof(channel_state_t)*max_sources;
+	const size_t size_gains = sizeof(float)*2*max_sources;
+	const size_t size_ints = sizeof(int32_t)*max_sources;
+
+	uint8_t* pool = (uint8_t*)tm.callbacks.allocate(tm.callbacks.udata, (int)(size_completions + size_sources + size_channels + size_gains + 2*size_ints));
+	memset(pool, 0, size_completions + size_sources + size_channels + size_gains + 2*size_ints);
+	tm.pool = pool;
+	tm.max_sources = max_sources;
+	tm.completion_mask = ncompletions - 1;
+	tm.completion_items = (completion_t*)pool; pool += size_completions;
+	tm.sources = (source_t*)pool; pool += size_sources;
+	tm.channels = (channel_state_t*)pool; pool += size_channels;
+	tm.gains = (float(*)[2])pool; pool += size_gains;
+	tm.playing = (int32_t*)pool; pool += size_ints;
+	tm.free_slots = (int32_t*)pool;
+
+	// lowest slots are handed out first
+	tm.nfree = max_sources;
+	for (int ii = 0; ii < max_sources; ++ii)
+		tm.free_slots[ii] = max_sources - 1 - ii;
+}
+
+void tm_init(tm_callbacks callbacks, int sample_rate, int max_sources) {
 	// setup default callbacks where needed
 	if (!callbacks.allocate) {
 		callbacks.allocate = _tm_default_allocate;
@@ -847,14 +1465,18 @@ void tm_init(tm_callbacks callbacks, int sample_rate) {
 		callbacks.free = _tm_default_free;
 	}
 
-	mt_mutex_init(&tm.lock);
+	tm.callbacks = callbacks;
+	_tm_create_pool(max_sources > 0 ? max_sources : N_SOURCES_DEFAULT);
+	mt_atomic_store(&tm.commands.head, 0);
+	mt_atomic_store(&tm.commands.tail, 0);
+	mt_atomic_store(&tm.completions.head, 0);
+	mt_atomic_store(&tm.completions.tail, 0);
 
 	tm.gain_master = 1.0f;
 	for (int ii = 0; ii < N_GAINTYPES; ++ii)
 		tm.gain_base[ii] = 1.0f;
 
 	tm.sample_rate = sample_rate;
-	tm.callbacks = callbacks;
 	tm.samples_remaining = 0;
 
 	// Default listener orientation: facing -Z, right is +X
@@ -865,74 +1487,95 @@ void tm_init(tm_callbacks callbacks, int sample_rate) {
 	const float default_multipliers[2] = {1.0f, 1.0f};
 	const float default_attack = 0.0f;
 	const float default_release = 0.0f;
-	tm_effects_compressor(default_thresholds, default_multipliers, default_attack, default_release);
+	float compressor[6];
+	_tm_compressor_args(default_thresholds, default_multipliers, default_attack, default_release, compressor);
+	_tm_set_compressor(compressor);
 	tm.compressor_factor = 1.0f;
 	tm.compressor_last_samples[0] = tm.compressor_last_samples[1] = 0;
+
+	tm.streams = NULL;
+	mt_mutex_init(&tm.decoder_lock);
+	mt_cond_init(&tm.decoder_wake);
+	mt_atomic_store(&tm.decoder_idle, 0);
+	mt_atomic_store(&tm.decoder_running, 1);
+	mt_thread_create(&tm.decoder, _tm_decoder_main, NULL);
+
+	// the mixer starts reading state only after this
+	mt_atomic_store(&tm.running, 1);
 }
 
+// the audio device must be stopped already, remaining sources are released here
 void tm_shutdown() {
-	mt_mutex_destroy(&tm.lock);
+	mt_atomic_store(&tm.running, 0);
+	run_commands();
+	for (int ii = 0; ii < tm.max_sources; ++ii) {
+		if (tm.sources[ii].buffer)
+			kill_source(&tm.sources[ii]);
+	}
+	_tm_drain_completions();
+
+	// under the lock, so the decoder is either waiting or sees the flag before it waits
+	mt_mutex_lock(&tm.decoder_lock);
+	mt_atomic_store(&tm.decoder_running, 0);
+	mt_cond_signal(&tm.decoder_wake);
+	mt_mutex_unlock(&tm.decoder_lock);
+	mt_thread_join(tm.decoder);
+	mt_cond_destroy(&tm.decoder_wake);
+	mt_mutex_destroy(&tm.decoder_lock);
+
+	tm.callbacks.free(tm.callbacks.udata, tm.pool);
+	tm.pool = NULL;
+	tm.max_sources = 0;
+	tm.nfree = 0;
 }
 
 void tm_update_listener(const float* position, const float* forward) {
-	mt_mutex_lock(&tm.lock);
-	_tm_vcopy(tm.position, position);
-	_tm_vcopy(tm.forward, forward);
-	// Compute right vector: cross(forward, up) where up = (0, 1, 0)
-	// right = (-forward.z, 0, forward.x)
-	float rx = -forward[2];
-	float rz = forward[0];
-	// Normalize the right vector (only x and z components, y is always 0)
-	float len = sqrtf(rx * rx + rz * rz);
-	if (len > 1.0e-8f) {
-		tm.right[0] = rx / len;
-		tm.right[1] = 0.0f;
-		tm.right[2] = rz / len;
-	} else {
-		// Fallback if forward is pointing straight up/down
-		tm.right[0] = 1.0f;
-		tm.right[1] = 0.0f;
-		tm.right[2] = 0.0f;
-	}
-	mt_mutex_unlock(&tm.lock);
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_LISTENER;
+	cmd.slot = -1;
+	_tm_vcopy(&cmd.args[0], position);
+	_tm_vcopy(&cmd.args[3], forward);
+	_tm_send(&cmd);
 }
 
 void tm_set_base_gain(int index, float gain) {
-	mt_mutex_lock(&tm.lock);
-	tm.gain_base[index] = gain;
-	mt_mutex_unlock(&tm.lock);
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_BASE_GAIN;
+	cmd.slot = -1;
+	cmd.gain_index = (uint8_t)index;
+	cmd.args[0] = gain;
+	_tm_send(&cmd);
 }
 
 void tm_set_callback_gain(float gain) {
-	mt_mutex_lock(&tm.lock);
-	tm.gain_callback = gain;
-	mt_mutex_unlock(&tm.lock);
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_CALLBACK_GAIN;
+	cmd.slot = -1;
+	cmd.args[0] = gain;
+	_tm_send(&cmd);
 }
 
 void tm_effects_compressor(const float thresholds[2], const float multipliers[2], float attack_seconds, float release_seconds) {
-	mt_mutex_lock(&tm.lock);
-	tm.compressor_thresholds[0] = _tm_clamp(thresholds[0], 0.0f, 1.0f);
-	tm.compressor_thresholds[1] = _tm_clamp(thresholds[1], 0.0f, 1.0f);
-	tm.compressor_multipliers[0] = _tm_clamp(multipliers[0], 0.0f, 1.0f);
-	tm.compressor_multipliers[1] = _tm_clamp(multipliers[1], 0.0f, 1.0f);
-
-    float attackSampleRate = (attack_seconds * (float)tm.sample_rate);
-	tm.compressor_attack_per1ksamples = (attackSampleRate > 0.0f) ? (1.0f / attackSampleRate) : 1.0f;
-
-    float releaseSampleRate = (release_seconds * (float)tm.sample_rate);
-	tm.compressor_release_per1ksamples = (releaseSampleRate > 0.0f) ? (1.0f / releaseSampleRate) : 1.0f;
-	mt_mutex_unlock(&tm.lock);
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_COMPRESSOR;
+	cmd.slot = -1;
+	_tm_compressor_args(thresholds, multipliers, attack_seconds, release_seconds, cmd.args);
+	_tm_send(&cmd);
 }
 
 void tm_stop_all_sources() {
-	mt_mutex_lock(&tm.lock);
-	for (int ii = 0; ii < N_SOURCES; ++ii) {
-		source_t* source = &tm.sources[ii];
-		if (source->buffer) {
-			kill_source(source);
-		}
+	_tm_drain_completions();
+	command_t cmd = {0};
+	cmd.type = TM_CMD_STOP_ALL;
+	cmd.slot = -1;
+	if (_tm_send(&cmd)) {
+		for (int ii = 0; ii < tm.max_sources; ++ii)
+			tm.channels[ii].playing = 0;
 	}
-	mt_mutex_unlock(&tm.lock);
 }
 
 void tm_resampler_init(tm_resampler* resampler, int input_sample_rate, int output_sample_rate) {
@@ -941,73 +1584,170 @@ void tm_resampler_init(tm_resampler* resampler, int input_sample_rate, int outpu
 }
 
 void tm_resampler_init_rate(tm_resampler* resampler, float ideal_rate) {
-	resampler->ideal_rate = ideal_rate;
-	resampler->prev_samples[0] = 0.0f;
-	resampler->prev_samples[1] = 0.0f;
+	memset(resampler, 0, sizeof(tm_resampler));
+	tm_resampler_set_rate(resampler, ideal_rate);
+
+	// the first output lands on the first input sample, history[] holds the four before it
+	resampler->phase = (uint64_t)3 << 32;
+}
+
+static void _tm_resampler_set_step(tm_resampler* resampler, double ideal_rate) {
+	resampler->ideal_rate = (float)ideal_rate;
+	resampler->step = (uint64_t)(ideal_rate * 4294967296.0 + 0.5);
+	if (resampler->step == 0)
+		resampler->step = 1;
+}
+
+void tm_resampler_set_rate(tm_resampler* resampler, float ideal_rate) {
+	_tm_resampler_set_step(resampler, ideal_rate);
 }
 
+// Positions count from history[0], an output at ip reads taps [ip, ip + 3] and interpolates between ip + 1 and
+// ip + 2. n inputs extend the sequence to n + 4 samples, so every output with ip <= n can be produced.
+// The input needed for output_samples outputs, this may be 0 while the history still covers them.
 int tm_resampler_calculate_input_samples(const tm_resampler* resampler, int output_samples) {
-	const float input_samples = ceilf(resampler->ideal_rate * (float)output_samples);
-	return (int)input_samples;
+	if (output_samples <= 0)
+		return 0;
+	const uint64_t last = resampler->phase + (uint64_t)(output_samples - 1)*resampler->step;
+	return (int)(last >> 32);
 }
 
+// the most outputs input_samples allow, producing fewer is fine as long as all the input was asked for
 int tm_resampler_calculate_output_samples(const tm_resampler* resampler, int input_samples) {
-	const float output_samples = ceilf((float)input_samples / resampler->ideal_rate);
-	return (int)output_samples;
+	const uint64_t end = (uint64_t)(input_samples + 1) << 32;
+	if (end <= resampler->phase)
+		return 0;
+	return (int)((end - resampler->phase + resampler->step - 1) / resampler->step);
 }
 
-void tm_resample_stereo(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples) {
-	float* output_end = output + (2 * num_output_samples) - 2;
-
-	float pos = resampler->ideal_rate;
-	while (pos < 1.0f) {
-		output[0] = resampler->prev_samples[0] + pos * (input[0] - resampler->prev_samples[0]);
-		output[1] = resampler->prev_samples[1] + pos * (input[1] - resampler->prev_samples[1]);
+static inline float _tm_tap(const float* history, const float* input, int stride, int index) {
+	return (index < 4) ? history[index] : input[(index - 4)*stride];
+}
 
-		output += 2;
-		pos += resampler->ideal_rate;
-	}
+static inline float _tm_interpolate(int quality, float p0, float p1, float p2, float p3, float f) {
+	if (quality == TM_RESAMPLE_LINEAR)
+		return p1 + f*(p2 - p1);
+	// Catmull-Rom
+	return p1 + 0.5f*f*(p2 - p0 + f*(2.0f*p0 - 5.0f*p1 + 4.0f*p2 - p3 + f*(3.0f*(p1 - p2) + p3 - p0)));
+}
 
-	while (output < output_end) {
-		const float pos_floor = floorf(pos);
-		const int index = 2 * (int)pos_floor;
-		output[0] = input[index - 2] + (input[index + 0] - input[index - 2]) * (pos - pos_floor);
-		output[1] = input[index - 1] + (input[index + 1] - input[index - 1]) * (pos - pos_floor);
+// one channel from the resampler's current phase, the phase itself is advanced by the caller
+static void _tm_resample_channel(const tm_resampler* resampler, const float* history, const float* input, int in_stride, float* output, int out_stride, int num_output_samples) {
+	const uint64_t step = resampler->step;
+	uint64_t pos = resampler->phase;
+	int ii = 0;
 
-		output += 2;
-		pos += resampler->ideal_rate;
+	// outputs that still read from the history
+	for (; ii < num_output_samples && (pos >> 32) < 4; ++ii, pos += step) {
+		const int ip = (int)(pos >> 32);
+		const float f = (float)(uint32_t)pos * (1.0f / 4294967296.0f);
+		output[ii*out_stride] = _tm_interpolate(resampler->quality,
+			_tm_tap(history, input, in_stride, ip + 0), _tm_tap(history, input, in_stride, ip + 1),
+			_tm_tap(history, input, in_stride, ip + 2), _tm_tap(history, input, in_stride, ip + 3), f);
 	}
 
-	output[0] = input[2 * num_input_samples - 2];
-	output[1] = input[2 * num_input_samples - 1];
+	// taps only come from input from here on, shift it so ip indexes it directly
+	const float* in = (ii < num_output_samples) ? input - 4*in_stride : NULL;
+
+#if defined(TM_USE_SSE) || defined(TM_USE_AVX2)
+	if (in_stride == 1 && out_stride == 1) {
+		const __m128 scale = _mm_set1_ps(1.0f / 4294967296.0f);
+		for (; ii + 4 <= num_output_samples; ii += 4) {
+			__m128 p[4];
+			float f[4];
+			float t[4][4];
+			for (int kk = 0; kk < 4; ++kk, pos += step) {
+				const float* tap = in + (pos >> 32);
+				t[0][kk] = tap[0]; t[1][kk] = tap[1]; t[2][kk] = tap[2]; t[3][kk] = tap[3];
+				f[kk] = (float)(uint32_t)pos;
+			}
+			for (int kk = 0; kk < 4; ++kk)
+				p[kk] = _mm_loadu_ps(t[kk]);
+			const __m128 x = _mm_mul_ps(_mm_loadu_ps(f), scale);
+			__m128 y;
+			if (resampler->quality == TM_RESAMPLE_LINEAR) {
+				y = _mm_add_ps(p[1], _mm_mul_ps(x, _mm_sub_ps(p[2], p[1])));
+			} else {
+				const __m128 c3 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_sub_ps(p[1], p[2])), _mm_sub_ps(p[3], p[0]));
+				const __m128 c2 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.0f), p[0]), _mm_mul_ps(_mm_set1_ps(4.0f), p[2])), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(5.0f), p[1]), p[3]));
+				const __m128 c1 = _mm_sub_ps(p[2], p[0]);
+				const __m128 poly = _mm_add_ps(c1, _mm_mul_ps(x, _mm_add_ps(c2, _mm_mul_ps(x, c3))));
+				y = _mm_add_ps(p[1], _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), poly));
+			}
+			_mm_storeu_ps(output + ii, y);
+		}
+	}
+#elif defined(TM_USE_NEON)
+	if (in_stride == 1 && out_stride == 1) {
+		for (; ii + 4 <= num_output_samples; ii += 4) {
+			float f[4];
+			float t[4][4];
+			for (int kk = 0; kk < 4; ++kk, pos += step) {
+				const float* tap = in + (pos >> 32);
+				t[0][kk] = tap[0]; t[1][kk] = tap[1]; t[2][kk] = tap[2]; t[3][kk] = tap[3];
+				f[kk] = (float)(uint32_t)pos;
+			}
+			const float32x4_t p0 = vld1q_f32(t[0]), p1 = vld1q_f32(t[1]), p2 = vld1q_f32(t[2]), p3 = vld1q_f32(t[3]);
+			const float32x4_t x = vmulq_n_f32(vld1q_f32(f), 1.0f / 4294967296.0f);
+			float32x4_t y;
+			if (resampler->quality == TM_RESAMPLE_LINEAR) {
+				y = vmlaq_f32(p1, x, vsubq_f32(p2, p1));
+			} else {
+				const float32x4_t c3 = vaddq_f32(vmulq_n_f32(vsubq_f32(p1, p2), 3.0f), vsubq_f32(p3, p0));
+				const float32x4_t c2 = vsubq_f32(vaddq_f32(vmulq_n_f32(p0, 2.0f), vmulq_n_f32(p2, 4.0f)), vaddq_f32(vmulq_n_f32(p1, 5.0f), p3));
+				const float32x4_t c1 = vsubq_f32(p2, p0);
+				const float32x4_t poly = vmlaq_f32(c1, x, vmlaq_f32(c2, x, c3));
+				y = vmlaq_f32(p1, vmulq_n_f32(x, 0.5f), poly);
+			}
+			vst1q_f32(output + ii, y);
+		}
+	}
+#endif
 
-	resampler->prev_samples[0] = output[0];
-	resampler->prev_samples[1] = output[1];
+	for (; ii < num_output_samples; ++ii, pos += step) {
+		const float* tap = in + (pos >> 32)*in_stride;
+		const float f = (float)(uint32_t)pos * (1.0f / 4294967296.0f);
+		output[ii*out_stride] = _tm_interpolate(resampler->quality, tap[0], tap[in_stride], tap[2*in_stride], tap[3*in_stride], f);
+	}
 }
 
-void tm_resample_mono(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples) {
-	float* output_end = output + num_output_samples - 1;
-
-	float pos = resampler->ideal_rate;
-	while (pos < 1.0f) {
-		output[0] = resampler->prev_samples[0] + pos * (input[0] - resampler->prev_samples[0]);
-
-		++output;
-		pos += resampler->ideal_rate;
-	}
+// keeps the last four samples of history and input as the new history
+static void _tm_resampler_advance(tm_resampler* resampler, int channel, const float* input, int stride, int num_input_samples) {
+	float* history = resampler->history[channel];
+	float next[4];
+	for (int ii = 0; ii < 4; ++ii)
+		next[ii] = _tm_tap(history, input, stride, num_input_samples + ii);
+	memcpy(history, next, sizeof(next));
+}
 
-	while (output < output_end) {
-		const float pos_floor = floorf(pos);
-		const int index = (int)pos_floor;
-		output[0] = input[index - 1] + (input[index] - input[index - 1]) * (pos - pos_floor);
+// moves the phase past the consumed input, this can't underflow if the input was sized with
+// tm_resampler_calculate_input_samples
+static void _tm_resampler_consume(tm_resampler* resampler, int num_input_samples, int num_output_samples) {
+	const uint64_t end = resampler->phase + (uint64_t)num_output_samples*resampler->step;
+	const uint64_t consumed = (uint64_t)num_input_samples << 32;
+	resampler->phase = (end > consumed) ? end - consumed : 0;
+}
 
-		++output;
-		pos += resampler->ideal_rate;
+void tm_resample_stereo(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples) {
+	for (int cc = 0; cc < 2; ++cc) {
+		_tm_resample_channel(resampler, resampler->history[cc], input + cc, 2, output + cc, 2, num_output_samples);
+		_tm_resampler_advance(resampler, cc, input + cc, 2, num_input_samples);
 	}
+	_tm_resampler_consume(resampler, num_input_samples, num_output_samples);
+}
 
-	output[0] = input[num_input_samples - 1];
+void tm_resample_mono(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples) {
+	_tm_resample_channel(resampler, resampler->history[0], input, 1, output, 1, num_output_samples);
+	_tm_resampler_advance(resampler, 0, input, 1, num_input_samples);
+	_tm_resampler_consume(resampler, num_input_samples, num_output_samples);
+}
 
-	resampler->prev_samples[0] = output[0];
+void tm_resample_planar(tm_resampler* resampler, const float* left, const float* right, int num_input_samples, float* output_left, float* output_right, int num_output_samples) {
+	_tm_resample_channel(resampler, resampler->history[0], left, 1, output_left, 1, num_output_samples);
+	_tm_resample_channel(resampler, resampler->history[1], right, 1, output_right, 1, num_output_samples);
+	_tm_resampler_advance(resampler, 0, left, 1, num_input_samples);
+	_tm_resampler_advance(resampler, 1, right, 1, num_input_samples);
+	_tm_resampler_consume(resampler, num_input_samples, num_output_samples);
 }
 
 void* tm_vorbis_malloc(size_t sz) {
@@ -53,6 +53,7 @@ typedef struct tm_channel {
 	int index;
 } tm_channel;
 
+// allocate and free are also called from the vorbis decoder thread
 typedef struct tm_callbacks {
 	void* udata;
 	void* (*allocate)(void* opaque, int bytes);
@@ -68,9 +69,17 @@ typedef struct tm_buffer_callbacks {
 	int (*request_samples)(void* buffer_opaque, void* source_opaque, const float** left, const float** right, int nsamples);
 } tm_buffer_callbacks;
 
+typedef enum tm_resample_quality {
+	TM_RESAMPLE_CUBIC,  // 4 point Catmull-Rom, the default
+	TM_RESAMPLE_LINEAR,
+} tm_resample_quality;
+
 typedef struct tm_resampler {
 	float ideal_rate;
-	float prev_samples[2];
+	uint64_t step;       // input samples per output sample, 32.32 fixed point
+	uint64_t phase;      // position of the next output, counted from history[0]
+	float history[2][4]; // last four input samples of each channel
+	int quality;         // tm_resample_quality
 } tm_resampler;
 
 typedef struct tm_lowpass_filter {
@@ -79,15 +88,24 @@ typedef struct tm_lowpass_filter {
 	float channel_history[2];
 } tm_lowpass_filter;
 
-void tm_init(tm_callbacks callbacks, int sample_rate);
+// tm_getsamples is called from the audio thread. Everything else must be called from a single
+// game thread; those calls only queue commands for the mixer and never block on it.
+// max_sources is the number of voices, 0 means 32. They are allocated with callbacks.allocate.
+void tm_init(tm_callbacks callbacks, int sample_rate, int max_sources);
 void tm_shutdown(void);
 void tm_getsamples(float* samples, int nsamples);
+// Releases finished sources and runs channel_complete callbacks on the calling thread. Call once per frame.
+void tm_update(void);
 void tm_set_mastergain(float gain);
 
 void tm_create_buffer_interleaved_s16le(int channels, const int16_t* pcm_data, int pcm_data_size, const tm_buffer** handle);
 void tm_create_buffer_interleaved_float(int channels, const float* pcm_data, int pcm_data_size, const tm_buffer** handle);
 void tm_create_buffer_vorbis_stream(const void* data, int ndata, void* opaque, void (*closed)(void*), const tm_buffer** handle);
+// Decodes the whole file once, all sources then share the PCM. Sets *handle to NULL if the data can't be decoded.
+void tm_create_buffer_vorbis_decoded(const void* data, int ndata, const tm_buffer** handle);
 void tm_create_buffer_custom_stream(void* opaque, tm_buffer_callbacks callbacks, const tm_buffer** buffer);
+// Sources playing the buffer are converted to the mixer rate. Vorbis buffers set this themselves.
+void tm_buffer_set_sample_rate(const tm_buffer* handle, int sample_rate);
 int tm_get_buffer_size(const tm_buffer* handle);
 void tm_release_buffer(const tm_buffer* handle);
 
@@ -107,6 +125,9 @@ void tm_channel_set_position(tm_channel channel, const float* position);
 void tm_channel_fadeout(tm_channel channel, float seconds);
 void tm_channel_set_gain(tm_channel channel, float gain);
 void tm_channel_set_frequency(tm_channel channel, float frequency);
+void tm_channel_set_resampler(tm_channel channel, tm_resample_quality quality);
+// When all voices are busy, the lowest priority non-looping sound is replaced first. Defaults to 0.
+void tm_channel_set_priority(tm_channel channel, int priority);
 
 float tm_channel_get_gain(tm_channel channel);
 void tm_stop_all_sources();
@@ -117,10 +138,14 @@ static inline bool tm_channel_equals(tm_channel lhs, tm_channel rhs) { return lh
 
 void tm_resampler_init(tm_resampler* resampler, int input_sample_rate, int output_sample_rate);
 void tm_resampler_init_rate(tm_resampler* resampler, float ideal_rate);
+// changes the rate without resetting the phase or history
+void tm_resampler_set_rate(tm_resampler* resampler, float ideal_rate);
+// Produce exactly tm_resampler_calculate_output_samples(num_input_samples) outputs, or the phase is lost.
 int tm_resampler_calculate_input_samples(const tm_resampler* resampler, int output_samples);
 int tm_resampler_calculate_output_samples(const tm_resampler* resampler, int input_samples);
 void tm_resample_stereo(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples);
 void tm_resample_mono(tm_resampler* resampler, const float* input, int num_input_samples, float* output, int num_output_samples);
+void tm_resample_planar(tm_resampler* resampler, const float* left, const float* right, int num_input_samples, float* output_left, float* output_right, int num_output_samples);
 
 void tm_lowpass_filter_init(tm_lowpass_filter* filter, float cutoff_frequency, float sample_rate);
 void tm_lowpass_filter_apply(tm_lowpass_filter* filter, float* output, float* input, int num_samples, int num_channels);
@@ -1,7 +1,51 @@
 #include "poki.h"
+
+//the dependencies allocate through the pk_desc allocator
+static void* _pk_dep_alloc(size_t size);
+static void* _pk_dep_calloc(size_t count, size_t size);
+static void* _pk_dep_realloc(void* ptr, size_t old_size, size_t new_size);
+static void _pk_dep_free(void* ptr);
+static void* _pk_sized_alloc(size_t size);
+static void* _pk_sized_calloc(size_t count, size_t size);
+static void* _pk_sized_realloc(void* ptr, size_t size);
+static void _pk_sized_free(void* ptr);
+
+#define HASHMAP_MALLOC(sz) _pk_dep_alloc(sz)
+#define HASHMAP_FREE(ptr) _pk_dep_free(ptr)
+#define CUTE_PNG_ALLOC _pk_sized_alloc
+#define CUTE_PNG_CALLOC _pk_sized_calloc
+#define CUTE_PNG_REALLOC _pk_sized_realloc
+#define CUTE_PNG_FREE _pk_sized_free
+#define QOI_MALLOC(sz) _pk_dep_alloc(sz)
+#define QOI_FREE(p) _pk_dep_free(p)
+#define twp_MALLOC(sz) _pk_dep_alloc(sz)
+#define twp_CALLOC(n, sz) _pk_dep_calloc(n, sz)
+#define twp_REALLOC(p, old_sz, new_sz) _pk_dep_realloc(p, old_sz, new_sz)
+#define twp_FREE(p) _pk_dep_free(p)
+#define M3D_MALLOC(sz) _pk_sized_alloc(sz)
+#define M3D_REALLOC(p, nsz) _pk_sized_realloc(p, nsz)
+#define M3D_FREE(p) _pk_sized_free(p)
+#define CGLTF_MALLOC(size) _pk_dep_alloc(size)
+#define CGLTF_FREE(ptr) _pk_dep_free(ptr)
+#define STS_VCO_MALLOC(sz) _pk_dep_alloc(sz)
+#define STS_VCO_FREE(p) _pk_dep_free(p)
+
 #include "shaders/gen_mips.glsl.h"
 #include "deps/hashmap.h"
+#include "deps/thread.h"
 #include <string.h>
+#include <math.h>
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #ifndef PK_NO_SAPP
 #include "deps/sokol_app.h"
@@ -54,7 +98,7 @@ static void* _default_alloc(size_t size, void* udata) {
     return malloc(size);
 }
 
-static void _default_free(void* udata, void* ptr) {
+static void _default_free(void* ptr, void* udata) {
     (void)udata;
     free(ptr);
 }
@@ -66,19 +110,574 @@ pk_allocator pk_default_allocator() {
     return alloc;
 }
 
+static pk_allocator _pk_allocator;
+static bool _pk_report_leaks;
+static size_t _pk_fetch_buffer_size;
+
+static void _pk_decode_setup(int num_threads);
+static void _pk_decode_shutdown(void);
+static void _pk_upload_setup(size_t budget);
+static void _pk_upload_shutdown(void);
+static void _pk_fetch_buffers_shutdown(void);
+static void _pk_cache_setup(int capacity, size_t budget);
+static void _pk_cache_shutdown(void);
+
+pk_allocator* pk_get_allocator(void) {
+    if (!_pk_allocator.alloc) {
+        _pk_allocator = pk_default_allocator();
+    }
+    return &_pk_allocator;
+}
+
+static void* _pk_dep_alloc(size_t size) {
+    return pk_alloc(pk_get_allocator(), size);
+}
+
+static void* _pk_dep_calloc(size_t count, size_t size) {
+    void* ptr = pk_alloc(pk_get_allocator(), count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+static void* _pk_dep_realloc(void* ptr, size_t old_size, size_t new_size) {
+    void* result = pk_alloc(pk_get_allocator(), new_size);
+    if (result && ptr) {
+        memcpy(result, ptr, old_size < new_size ? old_size : new_size);
+        pk_free(pk_get_allocator(), ptr);
+    }
+    return result;
+}
+
+static void _pk_dep_free(void* ptr) {
+    if (ptr) pk_free(pk_get_allocator(), ptr);
+}
+
+//m3d and cute_png realloc without passing the old size, so their blocks keep it in front of the data
+#define PK_SIZED_HEADER_SIZE (16)
+
+static void* _pk_sized_alloc(size_t size) {
+    uint8_t* block = (uint8_t*)pk_alloc(pk_get_allocator(), PK_SIZED_HEADER_SIZE + size);
+    if (!block) return NULL;
+    *(size_t*)block = size;
+    return block + PK_SIZED_HEADER_SIZE;
+}
+
+static void* _pk_sized_calloc(size_t count, size_t size) {
+    void* ptr = _pk_sized_alloc(count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+static void* _pk_sized_realloc(void* ptr, size_t size) {
+    void* result = _pk_sized_alloc(size);
+    if (result && ptr) {
+        size_t old_size = *(size_t*)((uint8_t*)ptr - PK_SIZED_HEADER_SIZE);
+        memcpy(result, ptr, old_size < size ? old_size : size);
+        _pk_sized_free(ptr);
+    }
+    return result;
+}
+
+static void _pk_sized_free(void* ptr) {
+    if (ptr) pk_free(pk_get_allocator(), (uint8_t*)ptr - PK_SIZED_HEADER_SIZE);
+}
+
+//turns a sized block into a plain allocator block, so it can be released with pk_free
+static void* _pk_sized_detach(void* ptr) {
+    uint8_t* block = (uint8_t*)ptr - PK_SIZED_HEADER_SIZE;
+    memmove(block, ptr, *(size_t*)block);
+    return block;
+}
+
+#define PK_ARENA_ALIGN (16)
+#define PK_ARENA_DEF_BLOCK_SIZE (64 * 1024)
+#define PK_FRAME_ARENA_DEF_SIZE (1024 * 1024)
+#define PK_DEF_DECODE_THREADS (2)
+#define PK_DEF_UPLOAD_BUDGET (8 * 1024 * 1024)
+#define PK_DEF_FETCH_BUFFER_SIZE (16 * 1024 * 1024)
+#define PK_DEF_ASSET_CAPACITY (256)
+#define PK_DEF_ASSET_BUDGET (256 * 1024 * 1024)
+
+struct pk_arena_block {
+    pk_arena_block* next;
+    size_t capacity;
+    size_t offset;
+};
+
+//the header is padded so block data starts aligned
+#define PK_ARENA_HEADER_SIZE ((sizeof(pk_arena_block) + PK_ARENA_ALIGN - 1) & ~(size_t)(PK_ARENA_ALIGN - 1))
+
+static pk_arena_block* _pk_arena_new_block(pk_arena* arena, size_t capacity) {
+    pk_arena_block* block = (pk_arena_block*)pk_alloc(&arena->backing, PK_ARENA_HEADER_SIZE + capacity);
+    pk_assert(block);
+    block->next = NULL;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
+}
+
+void pk_init_arena(pk_allocator* allocator, pk_arena* arena, size_t block_size) {
+    pk_assert(allocator && arena);
+    arena->backing = *allocator;
+    arena->block_size = PK_DEF(block_size, PK_ARENA_DEF_BLOCK_SIZE);
+    arena->first = NULL;
+    arena->current = NULL;
+}
+
+void pk_release_arena(pk_arena* arena) {
+    pk_assert(arena);
+    pk_arena_block* block = arena->first;
+    while (block) {
+        pk_arena_block* next = block->next;
+        pk_free(&arena->backing, block);
+        block = next;
+    }
+    arena->first = NULL;
+    arena->current = NULL;
+}
+
+void* pk_arena_alloc(pk_arena* arena, size_t size) {
+    pk_assert(arena);
+    size = (size + PK_ARENA_ALIGN - 1) & ~(size_t)(PK_ARENA_ALIGN - 1);
+    pk_arena_block* block = arena->current;
+    if (block && block->capacity - block->offset >= size) {
+        void* ptr = (uint8_t*)block + PK_ARENA_HEADER_SIZE + block->offset;
+        block->offset += size;
+        return ptr;
+    }
+
+    //reuse a block left over from before a rewind, or link in a new one after the current block
+    pk_arena_block* next = block ? block->next : arena->first;
+    while (next && next->capacity < size) {
+        next = next->next;
+    }
+    if (!next) {
+        next = _pk_arena_new_block(arena, size > arena->block_size ? size : arena->block_size);
+        if (block) {
+            next->next = block->next;
+            block->next = next;
+        } else {
+            next->next = arena->first;
+            arena->first = next;
+        }
+    }
+    next->offset = size;
+    arena->current = next;
+    return (uint8_t*)next + PK_ARENA_HEADER_SIZE;
+}
+
+pk_arena_mark pk_arena_get_mark(const pk_arena* arena) {
+    pk_assert(arena);
+    pk_arena_mark mark = { arena->current, arena->current ? arena->current->offset : 0 };
+    return mark;
+}
+
+void pk_rewind_arena(pk_arena* arena, pk_arena_mark mark) {
+    pk_assert(arena);
+    arena->current = mark.block;
+    if (mark.block) {
+        mark.block->offset = mark.offset;
+    }
+}
+
+void pk_reset_arena(pk_arena* arena) {
+    pk_assert(arena);
+    pk_arena_mark start = { NULL, 0 };
+    pk_rewind_arena(arena, start);
+}
+
+static void* _arena_alloc(size_t size, void* udata) {
+    return pk_arena_alloc((pk_arena*)udata, size);
+}
+
+static void _arena_free(void* ptr, void* udata) {
+    (void)ptr; (void)udata;
+}
+
+pk_allocator pk_arena_allocator(pk_arena* arena) {
+    pk_assert(arena);
+    pk_allocator alloc = {0};
+    alloc.alloc = _arena_alloc;
+    alloc.free = _arena_free;
+    alloc.udata = arena;
+    return alloc;
+}
+
+static pk_arena _pk_frame;
+
+pk_arena* pk_frame_arena(void) {
+    if (!_pk_frame.backing.alloc) {
+        pk_init_arena(pk_get_allocator(), &_pk_frame, PK_FRAME_ARENA_DEF_SIZE);
+    }
+    return &_pk_frame;
+}
+
+pk_allocator pk_frame_allocator(void) {
+    return pk_arena_allocator(pk_frame_arena());
+}
+
+void pk_reset_frame_allocator(void) {
+    pk_reset_arena(pk_frame_arena());
+}
+
+//every tracked allocation is preceded by this, linking it into the live list
+typedef struct _pk_tracked_block {
+    struct _pk_tracked_block* prev;
+    struct _pk_tracked_block* next;
+    size_t size;
+    pk_alloc_tag tag;
+} _pk_tracked_block;
+
+#define PK_TRACKED_HEADER_SIZE ((sizeof(_pk_tracked_block) + 15) & ~(size_t)15)
+
+#if defined(_MSC_VER)
+#define PK_THREAD_LOCAL __declspec(thread)
+#else
+#define PK_THREAD_LOCAL __thread
+#endif
+
+//per thread, so decode workers tag their own allocations
+static PK_THREAD_LOCAL pk_alloc_tag _pk_alloc_tag = PK_ALLOC_TAG_OTHER;
+
+pk_alloc_tag pk_set_alloc_tag(pk_alloc_tag tag) {
+    pk_alloc_tag prev = _pk_alloc_tag;
+    _pk_alloc_tag = tag;
+    return prev;
+}
+
+const char* pk_alloc_tag_name(pk_alloc_tag tag) {
+    switch (tag) {
+    case PK_ALLOC_TAG_OTHER: return "other";
+    case PK_ALLOC_TAG_MODEL: return "model";
+    case PK_ALLOC_TAG_ANIM: return "anim";
+    case PK_ALLOC_TAG_IMAGE: return "image";
+    case PK_ALLOC_TAG_AUDIO: return "audio";
+    default: return "total";
+    }
+}
+
+static void _pk_stats_add(pk_alloc_stats* stats, size_t size) {
+    stats->live_bytes += size;
+    stats->live_count++;
+    stats->total_count++;
+    if (stats->live_bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->live_bytes;
+    }
+}
+
+static void _pk_stats_remove(pk_alloc_stats* stats, size_t size) {
+    stats->live_bytes -= size;
+    stats->live_count--;
+}
+
+static void* _tracking_alloc(size_t size, void* udata) {
+    pk_alloc_tracker_view* view = (pk_alloc_tracker_view*)udata;
+    pk_alloc_tracker* tracker = view->tracker;
+    _pk_tracked_block* block = (_pk_tracked_block*)pk_alloc(&tracker->backing, PK_TRACKED_HEADER_SIZE + size);
+    if (!block) return NULL;
+    block->size = size;
+    block->tag = view->tag != PK_ALLOC_TAG_OTHER ? view->tag : _pk_alloc_tag;
+    block->prev = NULL;
+
+    mt_mutex_lock((mt_mutex*)tracker->lock);
+    block->next = (_pk_tracked_block*)tracker->live;
+    if (block->next) block->next->prev = block;
+    tracker->live = block;
+    _pk_stats_add(&tracker->stats[block->tag], size);
+    _pk_stats_add(&tracker->total, size);
+    mt_mutex_unlock((mt_mutex*)tracker->lock);
+    return (uint8_t*)block + PK_TRACKED_HEADER_SIZE;
+}
+
+static void _tracking_free(void* ptr, void* udata) {
+    if (!ptr) return;
+    pk_alloc_tracker* tracker = ((pk_alloc_tracker_view*)udata)->tracker;
+    _pk_tracked_block* block = (_pk_tracked_block*)((uint8_t*)ptr - PK_TRACKED_HEADER_SIZE);
+
+    mt_mutex_lock((mt_mutex*)tracker->lock);
+    if (block->prev) block->prev->next = block->next;
+    else tracker->live = block->next;
+    if (block->next) block->next->prev = block->prev;
+    _pk_stats_remove(&tracker->stats[block->tag], block->size);
+    _pk_stats_remove(&tracker->total, block->size);
+    mt_mutex_unlock((mt_mutex*)tracker->lock);
+    pk_free(&tracker->backing, block);
+}
+
+void pk_init_alloc_tracker(pk_allocator* backing, pk_alloc_tracker* tracker) {
+    pk_assert(backing && tracker);
+    memset(tracker, 0, sizeof(pk_alloc_tracker));
+    tracker->backing = *backing;
+    for (int i = 0; i < PK_ALLOC_TAG_COUNT; ++i) {
+        tracker->views[i].tracker = tracker;
+        tracker->views[i].tag = (pk_alloc_tag)i;
+    }
+    tracker->lock = pk_alloc(&tracker->backing, sizeof(mt_mutex));
+    pk_assert(tracker->lock);
+    mt_mutex_init((mt_mutex*)tracker->lock);
+}
+
+//live allocations are not freed, their owners may still use them
+void pk_release_alloc_tracker(pk_alloc_tracker* tracker) {
+    pk_assert(tracker && tracker->lock);
+    mt_mutex_destroy((mt_mutex*)tracker->lock);
+    pk_free(&tracker->backing, tracker->lock);
+    tracker->lock = NULL;
+}
+
+pk_allocator pk_tracking_allocator(pk_alloc_tracker* tracker, pk_alloc_tag tag) {
+    pk_assert(tracker && tag >= 0 && tag < PK_ALLOC_TAG_COUNT);
+    pk_allocator alloc = {0};
+    alloc.alloc = _tracking_alloc;
+    alloc.free = _tracking_free;
+    alloc.udata = &tracker->views[tag];
+    return alloc;
+}
+
+pk_alloc_stats pk_get_alloc_stats(pk_alloc_tracker* tracker, pk_alloc_tag tag) {
+    pk_assert(tracker && tag >= 0 && tag <= PK_ALLOC_TAG_COUNT);
+    mt_mutex_lock((mt_mutex*)tracker->lock);
+    pk_alloc_stats stats = tag == PK_ALLOC_TAG_COUNT ? tracker->total : tracker->stats[tag];
+    mt_mutex_unlock((mt_mutex*)tracker->lock);
+    return stats;
+}
+
+#define PK_MAX_REPORTED_LEAKS (32)
+
+size_t pk_report_alloc_leaks(pk_alloc_tracker* tracker) {
+    pk_assert(tracker);
+    mt_mutex_lock((mt_mutex*)tracker->lock);
+    size_t count = tracker->total.live_count;
+    if (count > 0) {
+        pk_printf("%zu allocations still live, %zu bytes\n", count, tracker->total.live_bytes);
+        for (int i = 0; i < PK_ALLOC_TAG_COUNT; ++i) {
+            const pk_alloc_stats* stats = &tracker->stats[i];
+            if (stats->live_count > 0) {
+                pk_printf("  %s: %zu allocations, %zu bytes\n", pk_alloc_tag_name((pk_alloc_tag)i), stats->live_count, stats->live_bytes);
+            }
+        }
+        int reported = 0;
+        for (_pk_tracked_block* block = (_pk_tracked_block*)tracker->live; block && reported < PK_MAX_REPORTED_LEAKS; block = block->next, reported++) {
+            pk_printf("  %p: %zu bytes (%s)\n", (void*)((uint8_t*)block + PK_TRACKED_HEADER_SIZE), block->size, pk_alloc_tag_name(block->tag));
+        }
+    }
+    mt_mutex_unlock((mt_mutex*)tracker->lock);
+    return count;
+}
+
 //---------------------------------------------------------------------------------
 //--INIT*SHUTDOWN------------------------------------------------------------------
 //---------------------------------------------------------------------------------
 
 
 void pk_setup(const pk_desc* desc) {
-    sg_setup(&desc->gfx);
-    sfetch_setup(&desc->fetch);
+    _pk_allocator = desc->allocator.alloc ? desc->allocator : pk_default_allocator();
+    pk_assert(_pk_allocator.alloc && _pk_allocator.free);
+    _pk_report_leaks = desc->report_leaks;
+    pk_assert(!_pk_report_leaks || _pk_allocator.alloc == _tracking_alloc);
+
+    //sokol takes the same callbacks, unless it got its own
+    sg_desc gfx = desc->gfx;
+    if (!gfx.allocator.alloc_fn) {
+        gfx.allocator = (sg_allocator){ _pk_allocator.alloc, _pk_allocator.free, _pk_allocator.udata };
+    }
+    sfetch_desc_t fetch = desc->fetch;
+    if (!fetch.allocator.alloc_fn) {
+        fetch.allocator = (sfetch_allocator_t){ _pk_allocator.alloc, _pk_allocator.free, _pk_allocator.udata };
+    }
+    sg_setup(&gfx);
+    sfetch_setup(&fetch);
+    _pk_decode_setup(PK_DEF(desc->decode_threads, PK_DEF_DECODE_THREADS));
+    _pk_upload_setup(PK_DEF(desc->upload_budget, PK_DEF_UPLOAD_BUDGET));
+    _pk_cache_setup(PK_DEF(desc->asset_capacity, PK_DEF_ASSET_CAPACITY), PK_DEF(desc->asset_budget, PK_DEF_ASSET_BUDGET));
+    _pk_fetch_buffer_size = PK_DEF(desc->fetch_buffer_size, PK_DEF_FETCH_BUFFER_SIZE);
+    pk_init_arena(&_pk_allocator, &_pk_frame, PK_DEF(desc->frame_arena_size, PK_FRAME_ARENA_DEF_SIZE));
 }
 
 void pk_shutdown(void) {
+    _pk_decode_shutdown();
+    //the cached textures still have queued uploads
+    _pk_cache_shutdown();
+    _pk_upload_shutdown();
+    pk_release_arena(&_pk_frame);
+    _pk_frame = (pk_arena){0};
     sfetch_shutdown();
+    _pk_fetch_buffers_shutdown();
     sg_shutdown();
+    if (_pk_report_leaks && _pk_allocator.alloc == _tracking_alloc) {
+        pk_report_alloc_leaks(((pk_alloc_tracker_view*)_pk_allocator.udata)->tracker);
+    }
+    _pk_allocator = (pk_allocator){0};
+}
+
+
+//---------------------------------------------------------------------------------
+//--UPLOAD-QUEUE-------------------------------------------------------------------
+//---------------------------------------------------------------------------------
+
+
+typedef enum {
+    _PK_UPLOAD_IMAGE,
+    _PK_UPLOAD_BUFFER,
+} _pk_upload_type;
+
+typedef struct _pk_upload {
+    struct _pk_upload* next;
+    _pk_upload_type type;
+    sg_image image;
+    sg_image_desc image_desc;
+    sg_view view; //optional texture view of the image, which can only be created after it
+    sg_buffer buffer;
+    sg_buffer_desc buffer_desc;
+    pk_allocator owner; //frees the data after the upload
+    size_t size;
+} _pk_upload;
+
+static struct {
+    _pk_upload* head;
+    _pk_upload* tail;
+    size_t budget;
+    pk_upload_stats stats;
+} _pk_uploads;
+
+static void _pk_upload_setup(size_t budget) {
+    memset(&_pk_uploads, 0, sizeof(_pk_uploads));
+    _pk_uploads.budget = budget;
+}
+
+static int _pk_image_level_count(const sg_image_desc* desc) {
+    return PK_DEF(desc->num_mipmaps, 1);
+}
+
+static void _pk_release_upload(_pk_upload* upload) {
+    if (upload->type == _PK_UPLOAD_IMAGE) {
+        pk_release_image_desc(&upload->owner, &upload->image_desc);
+    } else if (upload->buffer_desc.data.ptr) {
+        pk_free(&upload->owner, (void*)upload->buffer_desc.data.ptr);
+    }
+    pk_free(pk_get_allocator(), upload);
+}
+
+static void _pk_upload_shutdown(void) {
+    _pk_upload* upload = _pk_uploads.head;
+    while (upload) {
+        _pk_upload* next = upload->next;
+        _pk_release_upload(upload);
+        upload = next;
+    }
+    memset(&_pk_uploads, 0, sizeof(_pk_uploads));
+}
+
+static _pk_upload* _pk_push_upload(_pk_upload_type type, const pk_allocator* owner) {
+    _pk_upload* upload = (_pk_upload*)pk_alloc(pk_get_allocator(), sizeof(_pk_upload));
+    pk_assert(upload);
+    memset(upload, 0, sizeof(_pk_upload));
+    upload->type = type;
+    upload->owner = owner ? *owner : *pk_get_allocator();
+    if (_pk_uploads.tail) _pk_uploads.tail->next = upload;
+    else _pk_uploads.head = upload;
+    _pk_uploads.tail = upload;
+    return upload;
+}
+
+//copies of the data come from the pk_desc allocator, which frees them after the upload
+static void* _pk_copy_upload_data(sg_range data) {
+    void* copy = pk_alloc(pk_get_allocator(), data.size);
+    pk_assert(copy);
+    memcpy(copy, data.ptr, data.size);
+    return copy;
+}
+
+static void _pk_queue_image_view(sg_image image, sg_view view, const sg_image_desc* desc, pk_allocator* owner) {
+    pk_assert(desc);
+    _pk_upload* upload = _pk_push_upload(_PK_UPLOAD_IMAGE, owner);
+    upload->image = image;
+    upload->view = view;
+    upload->image_desc = *desc;
+    for (int i = 0; i < _pk_image_level_count(desc); ++i) {
+        sg_range* level = &upload->image_desc.data.mip_levels[i];
+        if (!owner && level->ptr) {
+            level->ptr = _pk_copy_upload_data(*level);
+        }
+        upload->size += level->size;
+    }
+    _pk_uploads.stats.queued++;
+    _pk_uploads.stats.queued_bytes += upload->size;
+}
+
+void pk_queue_image_init(sg_image image, const sg_image_desc* desc, pk_allocator* owner) {
+    _pk_queue_image_view(image, (sg_view){ SG_INVALID_ID }, desc, owner);
+}
+
+void pk_queue_buffer_init(sg_buffer buffer, const sg_buffer_desc* desc, pk_allocator* owner) {
+    pk_assert(desc);
+    _pk_upload* upload = _pk_push_upload(_PK_UPLOAD_BUFFER, owner);
+    upload->buffer = buffer;
+    upload->buffer_desc = *desc;
+    if (!owner && desc->data.ptr) {
+        upload->buffer_desc.data.ptr = _pk_copy_upload_data(desc->data);
+    }
+    upload->size = desc->data.size;
+    _pk_uploads.stats.queued++;
+    _pk_uploads.stats.queued_bytes += upload->size;
+}
+
+sg_image pk_queue_image_upload(const sg_image_desc* desc, pk_allocator* owner) {
+    sg_image image = sg_alloc_image();
+    pk_queue_image_init(image, desc, owner);
+    return image;
+}
+
+sg_buffer pk_queue_buffer_upload(const sg_buffer_desc* desc, pk_allocator* owner) {
+    sg_buffer buffer = sg_alloc_buffer();
+    pk_queue_buffer_init(buffer, desc, owner);
+    return buffer;
+}
+
+//the first upload of a frame always goes through, so bigger ones than the budget still make progress
+static void _pk_process_uploads(void) {
+    size_t uploaded = 0;
+    while (_pk_uploads.head && (uploaded == 0 || uploaded + _pk_uploads.head->size <= _pk_uploads.budget)) {
+        _pk_upload* upload = _pk_uploads.head;
+        _pk_uploads.head = upload->next;
+        if (!_pk_uploads.head) _pk_uploads.tail = NULL;
+
+        //the resource may have been destroyed while it waited
+        if (upload->type == _PK_UPLOAD_IMAGE) {
+            if (sg_query_image_state(upload->image) == SG_RESOURCESTATE_ALLOC) {
+                sg_init_image(upload->image, &upload->image_desc);
+            }
+            if (sg_query_view_state(upload->view) == SG_RESOURCESTATE_ALLOC) {
+                sg_init_view(upload->view, &(sg_view_desc) { .texture.image = upload->image });
+            }
+        } else {
+            if (sg_query_buffer_state(upload->buffer) == SG_RESOURCESTATE_ALLOC) {
+                sg_init_buffer(upload->buffer, &upload->buffer_desc);
+            }
+        }
+        uploaded += upload->size;
+        _pk_uploads.stats.queued--;
+        _pk_uploads.stats.queued_bytes -= upload->size;
+        _pk_release_upload(upload);
+    }
+    _pk_uploads.stats.frame_bytes = uploaded;
+    _pk_uploads.stats.total_bytes += uploaded;
+}
+
+pk_upload_stats pk_get_upload_stats(void) {
+    return _pk_uploads.stats;
+}
+
+bool pk_primitive_ready(const pk_primitive* primitive) {
+    pk_assert(primitive);
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; ++i) {
+        sg_buffer buf = primitive->bindings.vertex_buffers[i];
+        if (buf.id != SG_INVALID_ID && sg_query_buffer_state(buf) != SG_RESOURCESTATE_VALID) {
+            return false;
+        }
+    }
+    sg_buffer ibuf = primitive->bindings.index_buffer;
+    return ibuf.id == SG_INVALID_ID || sg_query_buffer_state(ibuf) == SG_RESOURCESTATE_VALID;
 }
 
 
@@ -340,6 +939,7 @@ sg_image_desc pk_gen_mipmaps_cpu(pk_allocator *allocator, const sg_image_desc *s
         levels = mip_levels;
     }
     sg_image_desc ret = {0};
+    pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_IMAGE);
     ret.width = src->width;
     ret.height = src->height;
     ret.pixel_format = src->pixel_format;
@@ -381,6 +981,7 @@ sg_image_desc pk_gen_mipmaps_cpu(pk_allocator *allocator, const sg_image_desc *s
         current_data = mip_data;
     }
 
+    pk_set_alloc_tag(tag);
     return ret;
 }
 
@@ -404,10 +1005,12 @@ void pk_checker_texture(pk_texture* tex) {
     sg_image_desc img = _pk_checker_image_desc();
     tex->image = sg_make_image(&img);
     tex->sampler = sg_make_sampler(&(sg_sampler_desc) { 0 });
+    tex->view = sg_make_view(&(sg_view_desc) { .texture.image = tex->image });
 }
 
 void pk_release_texture(pk_texture* tex) {
     pk_assert(tex);
+    sg_destroy_view(tex->view);
     sg_destroy_image(tex->image);
     sg_destroy_sampler(tex->sampler);
 }
@@ -483,6 +1086,92 @@ sg_vertex_layout_state pk_pnt_layout() {
     };
 }
 
+sg_vertex_layout_state pk_packed_layout() {
+    return (sg_vertex_layout_state) {
+        .buffers[0].stride = sizeof(pk_vertex_packed),
+        .attrs = {
+            [0].format = SG_VERTEXFORMAT_SHORT4N,
+            [1].format = SG_VERTEXFORMAT_SHORT2N,
+            [2].format = SG_VERTEXFORMAT_HALF2,
+        },
+    };
+}
+
+static int16_t _pk_snorm16(float v) {
+    v = v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v);
+    return (int16_t)(v * 32767.0f + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+//Float to half with round to nearest even. Too large values and NaNs become infinity.
+static uint16_t _pk_half(float f) {
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+    int32_t exp = (int32_t)((x >> 23) & 0xff) - 127 + 15;
+    uint32_t mant = x & 0x7fffff;
+    if (exp >= 31) return sign | 0x7c00;
+    uint32_t shift = 13;
+    if (exp <= 0) {
+        //denormal half
+        if (exp < -10) return sign;
+        mant |= 0x800000;
+        shift = (uint32_t)(14 - exp);
+        exp = 0;
+    }
+    uint32_t h = ((uint32_t)exp << 10) | (mant >> shift);
+    uint32_t rest = mant & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (h & 1))) h++;
+    return sign | (uint16_t)h;
+}
+
+//Octahedral normal encoding, oct_decode in common.inc.glsl reverses it.
+static void _pk_oct_encode(HMM_Vec3 n, int16_t out[2]) {
+    float l1 = fabsf(n.X) + fabsf(n.Y) + fabsf(n.Z);
+    float x = l1 > 0.0f ? n.X / l1 : 0.0f;
+    float y = l1 > 0.0f ? n.Y / l1 : 0.0f;
+    if (n.Z < 0.0f) {
+        float ox = x;
+        x = (1.0f - fabsf(y)) * (ox >= 0.0f ? 1.0f : -1.0f);
+        y = (1.0f - fabsf(ox)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+    out[0] = _pk_snorm16(x);
+    out[1] = _pk_snorm16(y);
+}
+
+pk_quant_params_t pk_pack_vertices(const pk_vertex_pnt* src, pk_vertex_packed* dst, size_t count) {
+    pk_assert(src && dst);
+    pk_quant_params_t quant = { 0 };
+    if (count == 0) return quant;
+
+    HMM_Vec3 min = src[0].pos;
+    HMM_Vec3 max = src[0].pos;
+    for (size_t i = 1; i < count; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            if (src[i].pos.Elements[c] < min.Elements[c]) min.Elements[c] = src[i].pos.Elements[c];
+            if (src[i].pos.Elements[c] > max.Elements[c]) max.Elements[c] = src[i].pos.Elements[c];
+        }
+    }
+    //the normalized shorts cover [-1, 1], so scale by half the extent around the center
+    for (int c = 0; c < 3; ++c) {
+        float extent = (max.Elements[c] - min.Elements[c]) * 0.5f;
+        quant.pos_scale.Elements[c] = extent > 0.0f ? extent : 1.0f;
+        quant.pos_offset.Elements[c] = (max.Elements[c] + min.Elements[c]) * 0.5f;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            float v = (src[i].pos.Elements[c] - quant.pos_offset.Elements[c]) / quant.pos_scale.Elements[c];
+            dst[i].pos[c] = _pk_snorm16(v);
+        }
+        dst[i].pos[3] = 0;
+        _pk_oct_encode(src[i].nrm, dst[i].nrm);
+        dst[i].uv[0] = _pk_half(src[i].uv.X);
+        dst[i].uv[1] = _pk_half(src[i].uv.Y);
+    }
+    return quant;
+}
+
 sg_vertex_layout_state pk_skinned_layout() {
     return (sg_vertex_layout_state) {
         .buffers = {
@@ -499,6 +1188,30 @@ sg_vertex_layout_state pk_skinned_layout() {
     };
 }
 
+sg_vertex_layout_state pk_pnt_instanced_layout() {
+    return (sg_vertex_layout_state) {
+        .buffers = {
+            [0].stride = sizeof(pk_vertex_pnt),
+            [PK_INSTANCE_BUFFER_SLOT] = {
+                .stride = sizeof(pk_instance),
+                .step_func = SG_VERTEXSTEP_PER_INSTANCE,
+            },
+        },
+        .attrs = {
+            [0] = {.buffer_index = 0, .format = SG_VERTEXFORMAT_FLOAT3},
+            [1] = {.buffer_index = 0, .format = SG_VERTEXFORMAT_FLOAT3},
+            [2] = {.buffer_index = 0, .format = SG_VERTEXFORMAT_FLOAT2},
+            //model matrix columns
+            [3] = {.buffer_index = PK_INSTANCE_BUFFER_SLOT, .format = SG_VERTEXFORMAT_FLOAT4},
+            [4] = {.buffer_index = PK_INSTANCE_BUFFER_SLOT, .format = SG_VERTEXFORMAT_FLOAT4},
+            [5] = {.buffer_index = PK_INSTANCE_BUFFER_SLOT, .format = SG_VERTEXFORMAT_FLOAT4},
+            [6] = {.buffer_index = PK_INSTANCE_BUFFER_SLOT, .format = SG_VERTEXFORMAT_FLOAT4},
+            //color
+            [7] = {.buffer_index = PK_INSTANCE_BUFFER_SLOT, .format = SG_VERTEXFORMAT_FLOAT4},
+        }
+    };
+}
+
 void pk_alloc_primitive(pk_primitive* primitive, uint16_t vbuf_count, uint16_t view_count) {
     pk_assert(primitive &&
         vbuf_count < SG_MAX_VERTEXBUFFER_BINDSLOTS &&
@@ -525,17 +1238,39 @@ void pk_init_primitive(pk_primitive* primitive, const pk_primitive_desc* desc) {
     bufdesc.usage.vertex_buffer = true;
     bufdesc.usage.immutable = !desc->is_mutable;
     bufdesc.data = desc->vertices;
-    primitive->bindings.vertex_buffers[0] = sg_make_buffer(&bufdesc);
+    primitive->bindings.vertex_buffers[0] = desc->queue_upload ? pk_queue_buffer_upload(&bufdesc, NULL) : sg_make_buffer(&bufdesc);
 
     if (desc->indices.size != 0) {
         bufdesc.data = desc->indices;
         bufdesc.usage.immutable = !desc->is_mutable;
         bufdesc.usage.index_buffer = true;
-        primitive->bindings.index_buffer = sg_make_buffer(&bufdesc);
+        primitive->bindings.index_buffer = desc->queue_upload ? pk_queue_buffer_upload(&bufdesc, NULL) : sg_make_buffer(&bufdesc);
     }
 
     primitive->base_element = 0;
     primitive->num_elements = desc->num_elements;
+    primitive->base_vertex = 0;
+    primitive->index_type = desc->indices.size != 0 ? PK_DEF(desc->index_type, SG_INDEXTYPE_UINT32) : SG_INDEXTYPE_NONE;
+    primitive->packed = false;
+    memset(&primitive->quant, 0, sizeof(primitive->quant));
+}
+
+//Picks 16 bit indices, if every index fits.
+static sg_index_type _pk_index_type(size_t vertex_count) {
+    return vertex_count <= UINT16_MAX ? SG_INDEXTYPE_UINT16 : SG_INDEXTYPE_UINT32;
+}
+
+//Narrows the indices in place for 16 bit index buffers and returns the range to upload.
+//Going front to back never overwrites an index, which wasn't read yet.
+static sg_range _pk_index_range(uint32_t* indices, size_t count, sg_index_type type) {
+    if (type == SG_INDEXTYPE_UINT16) {
+        uint16_t* dst = (uint16_t*)indices;
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = (uint16_t)indices[i];
+        }
+        return (sg_range){ indices, count * sizeof(uint16_t) };
+    }
+    return (sg_range){ indices, count * sizeof(uint32_t) };
 }
 
 static bool _pk_hashmap_init(pk_allocator* alloc, hashmap* map, size_t key_size, size_t value_size, size_t capacity) {
@@ -556,10 +1291,16 @@ static bool _pk_hashmap_init(pk_allocator* alloc, hashmap* map, size_t key_size,
     return true;
 }
 
-bool pk_load_m3d(pk_allocator* allocator, pk_primitive* prim, pk_node* node, m3d_t* m3d) {
-    pk_assert(m3d && prim);
+bool pk_load_m3d(pk_allocator* allocator, pk_primitive* prim, pk_node* node, m3d_t* m3d, const pk_m3d_desc* desc) {
+    pk_assert(m3d && prim && desc);
+    pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_MODEL);
     sg_resource_state bones_state = sg_query_buffer_state(prim->bindings.vertex_buffers[0]);
     bool has_skin = (m3d->numbone > 0 && m3d->numskin > 0 && bones_state == SG_RESOURCESTATE_ALLOC);
+    //the skinned shader reads pk_vertex_pnt, so skinned models stay unpacked
+    bool packed = desc->packed_vertices && !has_skin;
+    if (desc->packed_vertices && has_skin) {
+        pk_printf("m3d %s is skinned, loading it without packed vertices\n", m3d->name);
+    }
 
     typedef struct {
         uint32_t vertex_idx;
@@ -568,15 +1309,25 @@ bool pk_load_m3d(pk_allocator* allocator, pk_primitive* prim, pk_node* node, m3d
     } vertex_key;
 
     uint32_t max_vertices = m3d->numface * 3;
-    pk_vertex_pnt* unique_pnt = pk_alloc(allocator, max_vertices * sizeof(pk_vertex_pnt));
-    pk_vertex_skin* unique_skin = has_skin ? pk_alloc(allocator, max_vertices * sizeof(pk_vertex_skin)) : NULL;
-    uint32_t* indices = pk_alloc(allocator, m3d->numface * 3 * sizeof(uint32_t));
+    size_t map_capacity = max_vertices * 2;
+
+    //all temporaries live in one arena block, sized up front, and go away together
+    size_t scratch_size = max_vertices * (sizeof(pk_vertex_pnt) + sizeof(uint32_t))
+        + map_capacity * (sizeof(vertex_key) + sizeof(uint32_t) + 1) + 8 * 16;
+    if (has_skin) scratch_size += max_vertices * sizeof(pk_vertex_skin);
+    if (packed) scratch_size += max_vertices * sizeof(pk_vertex_packed);
+    pk_arena scratch;
+    pk_init_arena(allocator, &scratch, scratch_size);
+    pk_allocator scratch_alloc = pk_arena_allocator(&scratch);
+
+    pk_vertex_pnt* unique_pnt = pk_alloc(&scratch_alloc, max_vertices * sizeof(pk_vertex_pnt));
+    pk_vertex_skin* unique_skin = has_skin ? pk_alloc(&scratch_alloc, max_vertices * sizeof(pk_vertex_skin)) : NULL;
+    uint32_t* indices = pk_alloc(&scratch_alloc, m3d->numface * 3 * sizeof(uint32_t));
     pk_assert(unique_pnt && indices);
     if (has_skin) pk_assert(unique_skin);
 
-    size_t map_capacity = max_vertices * 2;
     hashmap vertex_map = {0};
-    bool ok = _pk_hashmap_init(allocator, &vertex_map, sizeof(vertex_key), sizeof(uint32_t), map_capacity);
+    bool ok = _pk_hashmap_init(&scratch_alloc, &vertex_map, sizeof(vertex_key), sizeof(uint32_t), map_capacity);
     pk_assert(ok);
     uint32_t vertex_count = 0;
     uint32_t index_count = 0;
@@ -633,29 +1384,38 @@ bool pk_load_m3d(pk_allocator* allocator, pk_primitive* prim, pk_node* node, m3d
         }
     }
 
-    pk_free(allocator, vertex_map.keys);
-    pk_free(allocator, vertex_map.values);
-    pk_free(allocator, vertex_map.used);
-
     sg_buffer_desc bd = { 0 };
     bd.usage.vertex_buffer = true;
     bd.usage.immutable = true;
-    bd.data = (sg_range){ unique_pnt, vertex_count * sizeof(pk_vertex_pnt) };
-    sg_init_buffer(prim->bindings.vertex_buffers[0], &bd);
+    pk_vertex_packed* packed_vertices = NULL;
+    prim->packed = packed;
+    if (packed) {
+        packed_vertices = pk_alloc(&scratch_alloc, vertex_count * sizeof(pk_vertex_packed));
+        pk_assert(packed_vertices);
+        prim->quant = pk_pack_vertices(unique_pnt, packed_vertices, vertex_count);
+        bd.data = (sg_range){ packed_vertices, vertex_count * sizeof(pk_vertex_packed) };
+    } else {
+        bd.data = (sg_range){ unique_pnt, vertex_count * sizeof(pk_vertex_pnt) };
+    }
+    if (desc->queue_uploads) pk_queue_buffer_init(prim->bindings.vertex_buffers[0], &bd, NULL);
+    else sg_init_buffer(prim->bindings.vertex_buffers[0], &bd);
 
     if (has_skin) {
         bd.usage.vertex_buffer = true;
         bd.usage.immutable = true;
         bd.data = (sg_range){ unique_skin, vertex_count * sizeof(pk_vertex_skin) };
-        sg_init_buffer(prim->bindings.vertex_buffers[1], &bd);
+        if (desc->queue_uploads) pk_queue_buffer_init(prim->bindings.vertex_buffers[1], &bd, NULL);
+        else sg_init_buffer(prim->bindings.vertex_buffers[1], &bd);
     }
 
     stsvco_optimize(indices, index_count, vertex_count, 32);
 
+    prim->index_type = _pk_index_type(vertex_count);
     bd.usage.vertex_buffer = false;
     bd.usage.index_buffer = true;
-    bd.data = (sg_range){ indices, index_count * sizeof(uint32_t) };
-    sg_init_buffer(prim->bindings.index_buffer, &bd);
+    bd.data = _pk_index_range(indices, index_count, prim->index_type);
+    if (desc->queue_uploads) pk_queue_buffer_init(prim->bindings.index_buffer, &bd, NULL);
+    else sg_init_buffer(prim->bindings.index_buffer, &bd);
 
     if (node) {
         node->scale.X = m3d->scale;
@@ -666,10 +1426,9 @@ bool pk_load_m3d(pk_allocator* allocator, pk_primitive* prim, pk_node* node, m3d
     prim->base_element = 0;
     prim->num_elements = index_count;
 
-    pk_free(allocator, unique_pnt);
-    pk_free(allocator, indices);
-    if (unique_skin != NULL) { pk_free(allocator, unique_skin); }
+    pk_release_arena(&scratch);
     pk_printf("Loaded pk_primitive %s\n", m3d->name);
+    pk_set_alloc_tag(tag);
     return true;
 }
 
@@ -679,7 +1438,9 @@ void pk_release_primitive(pk_primitive* primitive) {
         sg_destroy_buffer(primitive->bindings.vertex_buffers[i]);
     }
     for (int i = 0; i < SG_MAX_VIEW_BINDSLOTS; ++i) {
-        sg_destroy_view(primitive->bindings.views[i]);
+        if (!(primitive->shared_views & (1u << i))) {
+            sg_destroy_view(primitive->bindings.views[i]);
+        }
     }
     sg_destroy_buffer(primitive->bindings.index_buffer);
 }
@@ -687,15 +1448,78 @@ void pk_release_primitive(pk_primitive* primitive) {
 void pk_texture_primitive(pk_primitive* primitive, const pk_texture* tex, int slot) {
     pk_assert(primitive && tex && slot < SG_MAX_TEXTURE_SAMPLER_PAIRS);
     primitive->bindings.samplers[slot] = tex->sampler;
-    primitive->bindings.views[slot] = sg_make_view(&(sg_view_desc) {
-        .texture.image = tex->image,
-    });
+    if (tex->view.id != SG_INVALID_ID) {
+        primitive->bindings.views[slot] = tex->view;
+        primitive->shared_views |= 1u << slot;
+    } else {
+        primitive->bindings.views[slot] = sg_make_view(&(sg_view_desc) {
+            .texture.image = tex->image,
+        });
+        primitive->shared_views &= ~(1u << slot);
+    }
+}
+
+static void _pk_draw_elements(const pk_primitive* primitive, int num_instances) {
+    if (primitive->packed) {
+        sg_apply_uniforms(UB_pk_quant_params, &SG_RANGE(primitive->quant));
+    }
+    if (primitive->base_vertex != 0) {
+        sg_draw_ex(primitive->base_element, primitive->num_elements, num_instances, primitive->base_vertex, 0);
+    } else {
+        sg_draw(primitive->base_element, primitive->num_elements, num_instances);
+    }
 }
 
 void pk_draw_primitive(const pk_primitive* primitive, int num_instances) {
     pk_assert(primitive);
     sg_apply_bindings(&primitive->bindings);
-    sg_draw(primitive->base_element, primitive->num_elements, num_instances);
+    _pk_draw_elements(primitive, num_instances);
+}
+
+
+//---------------------------------------------------------------------------------
+//--INSTANCING---------------------------------------------------------------------
+//---------------------------------------------------------------------------------
+
+
+void pk_init_instance_buffer(pk_instance_buffer* buf, int capacity) {
+    pk_assert(buf && capacity > 0);
+    buf->buffer = sg_make_buffer(&(sg_buffer_desc) {
+        .usage = {
+            .vertex_buffer = true,
+            .stream_update = true,
+        },
+        .size = (size_t)capacity * sizeof(pk_instance),
+        .label = "pk_instance_buffer",
+    });
+    buf->capacity = capacity;
+    buf->count = 0;
+}
+
+void pk_update_instance_buffer(pk_instance_buffer* buf, const pk_instance* instances, int count) {
+    pk_assert(buf && instances && count <= buf->capacity);
+    buf->count = count;
+    if (count > 0) {
+        sg_update_buffer(buf->buffer, &(sg_range){instances, (size_t)count * sizeof(pk_instance)});
+    }
+}
+
+void pk_release_instance_buffer(pk_instance_buffer* buf) {
+    pk_assert(buf);
+    sg_destroy_buffer(buf->buffer);
+    buf->buffer.id = SG_INVALID_ID;
+    buf->capacity = 0;
+    buf->count = 0;
+}
+
+void pk_draw_primitive_instanced(const pk_primitive* primitive, const pk_instance_buffer* buf) {
+    pk_assert(primitive && buf && !primitive->packed);
+    if (buf->count == 0) return;
+    sg_bindings bind = primitive->bindings;
+    bind.vertex_buffers[PK_INSTANCE_BUFFER_SLOT] = buf->buffer;
+    bind.vertex_buffer_offsets[PK_INSTANCE_BUFFER_SLOT] = 0;
+    sg_apply_bindings(&bind);
+    _pk_draw_elements(primitive, buf->count);
 }
 
 
@@ -712,16 +1536,24 @@ void pk_init_node(pk_node* node) {
     node->position = HMM_V3(0, 0, 0);
     node->scale = HMM_V3(1, 1, 1);
     node->rotation = HMM_Q(0, 0, 0, 1);
+    node->dirty = true;
 }
 
-HMM_Mat4 pk_node_transform(const pk_node* node) {
+HMM_Mat4 pk_node_local_transform(const pk_node* node) {
     pk_assert(node);
+    //same as translate * rotate * scale, without the two matrix multiplications
+    HMM_Mat4 ret = HMM_QToM4(node->rotation);
+    ret.Columns[0] = HMM_MulV4F(ret.Columns[0], node->scale.X);
+    ret.Columns[1] = HMM_MulV4F(ret.Columns[1], node->scale.Y);
+    ret.Columns[2] = HMM_MulV4F(ret.Columns[2], node->scale.Z);
+    ret.Columns[3] = HMM_V4V(node->position, 1.0f);
+    return ret;
+}
 
-    HMM_Mat4 pos = HMM_Translate(node->position);
-    HMM_Mat4 rot = HMM_QToM4(node->rotation);
-    HMM_Mat4 scl = HMM_Scale(node->scale);
+HMM_Mat4 pk_node_transform(const pk_node* node) {
+    pk_assert(node);
 
-    HMM_Mat4 ret = HMM_MulM4(pos, HMM_MulM4(rot, scl));
+    HMM_Mat4 ret = pk_node_local_transform(node);
 
     if (node->parent != NULL) {
         HMM_Mat4 parent_transform = pk_node_transform(node->parent);
@@ -743,44 +1575,119 @@ void pk_release_mesh(pk_mesh* mesh) {
     }
 }
 
-void pk_draw_mesh(pk_mesh* mesh, pk_vs_params_t* vs_params) {
-    pk_assert(mesh && vs_params);
-    vs_params->model = pk_node_transform(mesh->node);
+//instances may be NULL for regular draws. last_bind remembers the applied bindings across meshes,
+//so primitives sharing the merged buffers of a model are not bound again.
+static void _pk_draw_mesh_primitives(const pk_mesh* mesh, const pk_vs_params_t* vs_params, const pk_instance_buffer* instances, const sg_bindings** last_bind) {
     sg_apply_uniforms(UB_pk_vs_params, &(sg_range){vs_params, sizeof(pk_vs_params_t)});
     for (uint16_t i = 0; i < mesh->primitive_count; ++i) {
-        pk_draw_primitive(&mesh->primitives[i], 1);
+        const pk_primitive* primitive = &mesh->primitives[i];
+        if (instances) {
+            pk_draw_primitive_instanced(primitive, instances);
+            continue;
+        }
+        if (*last_bind == NULL || memcmp(*last_bind, &primitive->bindings, sizeof(sg_bindings)) != 0) {
+            sg_apply_bindings(&primitive->bindings);
+            *last_bind = &primitive->bindings;
+        }
+        _pk_draw_elements(primitive, 1);
     }
 }
 
+void pk_draw_mesh(pk_mesh* mesh, pk_vs_params_t* vs_params) {
+    pk_assert(mesh && vs_params);
+    vs_params->model = pk_node_transform(mesh->node);
+    const sg_bindings* last_bind = NULL;
+    _pk_draw_mesh_primitives(mesh, vs_params, NULL, &last_bind);
+}
+
+void pk_draw_mesh_instanced(pk_mesh* mesh, pk_vs_params_t* vs_params, const pk_instance_buffer* buf) {
+    pk_assert(mesh && vs_params && buf);
+    if (buf->count == 0) return;
+    vs_params->model = pk_node_transform(mesh->node);
+    const sg_bindings* last_bind = NULL;
+    _pk_draw_mesh_primitives(mesh, vs_params, buf, &last_bind);
+}
+
 
 //---------------------------------------------------------------------------------
 //--MODEL/GLTF---------------------------------------------------------------------
 //---------------------------------------------------------------------------------
 
 
-static uint32_t* load_indices(pk_allocator* allocator, const cgltf_primitive* prim, size_t* index_count) {
+//Returns the element data of an accessor, if it can be copied directly instead of
+//going through cgltf_accessor_read_*, so it must not be sparse or normalized.
+static const uint8_t* _pk_accessor_data(const cgltf_accessor* accessor, cgltf_component_type component_type, size_t num_components) {
+    if (accessor->is_sparse || accessor->normalized || accessor->buffer_view == NULL) return NULL;
+    if (accessor->component_type != component_type) return NULL;
+    if (cgltf_num_components(accessor->type) != num_components) return NULL;
+    const uint8_t* data = cgltf_buffer_view_data(accessor->buffer_view);
+    return data ? data + accessor->offset : NULL;
+}
+
+//Writes the indices to dst, if it is not NULL. Returns the index count.
+static size_t load_indices(const cgltf_primitive* prim, uint32_t* dst) {
     if (!prim->indices) {
         pk_printf("No indices found in model!\n");
-        return NULL;
+        return 0;
     }
 
     const cgltf_accessor* index_accessor = prim->indices;
     size_t gltf_index_count = index_accessor->count;
-    *index_count = gltf_index_count;
-    uint32_t* indices = pk_alloc(allocator, gltf_index_count * sizeof(uint32_t));
-    pk_assert(indices);
-
-    for (size_t i = 0; i < gltf_index_count; ++i) {
-        uint32_t index = 0;
-        cgltf_accessor_read_uint(index_accessor, i, &index, 1);
-        indices[i] = index;
-    }
-
-    return indices;
-}
-
-static pk_vertex_pnt* interleave_attributes(pk_allocator* allocator, const cgltf_primitive* primitive, size_t* vertex_count) {
-    cgltf_accessor* position_accessor = NULL;
+    if (dst == NULL) return gltf_index_count;
+
+    //gltf requires accessor offsets to be aligned to the component size, so the casts are fine
+    const uint8_t* src = _pk_accessor_data(index_accessor, index_accessor->component_type, 1);
+    const size_t stride = index_accessor->stride;
+    if (src && index_accessor->component_type == cgltf_component_type_r_32u) {
+        if (stride == sizeof(uint32_t)) {
+            memcpy(dst, src, gltf_index_count * sizeof(uint32_t));
+        } else {
+            for (size_t i = 0; i < gltf_index_count; ++i) {
+                dst[i] = *(const uint32_t*)(src + i * stride);
+            }
+        }
+    } else if (src && index_accessor->component_type == cgltf_component_type_r_16u && stride == sizeof(uint16_t)) {
+        const uint16_t* src16 = (const uint16_t*)src;
+        for (size_t i = 0; i < gltf_index_count; ++i) {
+            dst[i] = src16[i];
+        }
+    } else if (src && index_accessor->component_type == cgltf_component_type_r_8u && stride == sizeof(uint8_t)) {
+        for (size_t i = 0; i < gltf_index_count; ++i) {
+            dst[i] = src[i];
+        }
+    } else {
+        for (size_t i = 0; i < gltf_index_count; ++i) {
+            uint32_t index = 0;
+            cgltf_accessor_read_uint(index_accessor, i, &index, 1);
+            dst[i] = index;
+        }
+    }
+
+    return gltf_index_count;
+}
+
+//Copies num_components floats per vertex into the vertex member at dst_offset.
+//Vertices beyond the accessor count are left untouched.
+static void _pk_copy_vertex_attribute(const cgltf_accessor* accessor, size_t num_components, pk_vertex_pnt* dst, size_t dst_offset, size_t vertex_count) {
+    const size_t count = accessor->count < vertex_count ? accessor->count : vertex_count;
+    uint8_t* out = (uint8_t*)dst + dst_offset;
+    const uint8_t* src = _pk_accessor_data(accessor, cgltf_component_type_r_32f, num_components);
+    if (src) {
+        const size_t stride = accessor->stride;
+        const size_t size = num_components * sizeof(float);
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(out + i * sizeof(pk_vertex_pnt), src + i * stride, size);
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            cgltf_accessor_read_float(accessor, i, (float*)(out + i * sizeof(pk_vertex_pnt)), num_components);
+        }
+    }
+}
+
+//Writes the interleaved vertices to dst, if it is not NULL. Returns the vertex count.
+static size_t interleave_attributes(const cgltf_primitive* primitive, pk_vertex_pnt* dst) {
+    cgltf_accessor* position_accessor = NULL;
     cgltf_accessor* normal_accessor = NULL;
     cgltf_accessor* uv_accessor = NULL;
 
@@ -805,31 +1712,23 @@ static pk_vertex_pnt* interleave_attributes(pk_allocator* allocator, const cgltf
     //This should fail, if there is not at least a position attribute...
     if (!position_accessor) {
         pk_printf("No position attribute found in gltf primitive!\n");
-        return NULL;
+        return 0;
     }
 
     size_t gltf_vertex_count = position_accessor->count;
-    *vertex_count = gltf_vertex_count;
-
-    pk_vertex_pnt* interleaved = pk_alloc(allocator, gltf_vertex_count * sizeof(pk_vertex_pnt));
-
-    for (size_t i = 0; i < gltf_vertex_count; ++i) {
-        pk_vertex_pnt vertex = {0};
-
-        if (position_accessor) {
-            cgltf_accessor_read_float(position_accessor, i, vertex.pos.Elements, 3);
-        }
-        if (normal_accessor) {
-            cgltf_accessor_read_float(normal_accessor, i, vertex.nrm.Elements, 3);
-        }
-        if (uv_accessor) {
-            cgltf_accessor_read_float(uv_accessor, i, vertex.uv.Elements, 2);
-        }
+    if (dst == NULL) return gltf_vertex_count;
 
-        interleaved[i] = vertex;
+    //one pass per attribute, so the fast path is a plain strided copy
+    memset(dst, 0, gltf_vertex_count * sizeof(pk_vertex_pnt));
+    _pk_copy_vertex_attribute(position_accessor, 3, dst, offsetof(pk_vertex_pnt, pos), gltf_vertex_count);
+    if (normal_accessor) {
+        _pk_copy_vertex_attribute(normal_accessor, 3, dst, offsetof(pk_vertex_pnt, nrm), gltf_vertex_count);
+    }
+    if (uv_accessor) {
+        _pk_copy_vertex_attribute(uv_accessor, 2, dst, offsetof(pk_vertex_pnt, uv), gltf_vertex_count);
     }
 
-    return interleaved;
+    return gltf_vertex_count;
 }
 
 // keep as reminder for skinning
@@ -883,35 +1782,69 @@ static array_t<pk_vertex_skin> interleave_attributes_skin(const cgltf_primitive&
 }
 */
 
-static pk_node* load_scene_nodes(pk_allocator* allocator, cgltf_data* data, size_t* node_count) {
+//Returns a mapping from gltf node index to pk_model node index, allocated from the scratch arena.
+//The nodes are sorted breadth first, so parents always come before their children.
+static size_t* sort_scene_nodes(pk_allocator* allocator, cgltf_data* data) {
+    size_t* order = (size_t*)pk_alloc(allocator, sizeof(size_t) * data->nodes_count);
+    size_t* remap = (size_t*)pk_alloc(allocator, sizeof(size_t) * data->nodes_count);
+    pk_assert(order && remap);
+
+    size_t head = 0, tail = 0;
+    for (size_t i = 0; i < data->nodes_count; ++i) {
+        if (!data->nodes[i].parent) {
+            order[tail++] = i;
+        }
+    }
+    while (head < tail) {
+        const cgltf_node* gl_node = &data->nodes[order[head++]];
+        for (size_t i = 0; i < gl_node->children_count; ++i) {
+            order[tail++] = cgltf_node_index(data, gl_node->children[i]);
+        }
+    }
+    pk_assert(tail == data->nodes_count);
+
+    for (size_t i = 0; i < data->nodes_count; ++i) {
+        remap[order[i]] = i;
+    }
+    return remap;
+}
+
+static pk_node* load_scene_nodes(pk_allocator* allocator, cgltf_data* data, const size_t* remap) {
     pk_node* nodes = (pk_node*)pk_alloc(allocator, sizeof(pk_node) * data->nodes_count);
     pk_assert(nodes);
-    *node_count = data->nodes_count;
 
     for (size_t i = 0; i < data->nodes_count; i++) {
         const cgltf_node* gl_node = &data->nodes[i];
+        pk_node* node = &nodes[remap[i]];
 
         // Set node properties
         const char* nodeName = gl_node->name ? gl_node->name : "UNNAMED";
-        strncpy(nodes[i].name, nodeName, PK_MAX_NAME_LEN - 1);
-        nodes[i].name[sizeof(nodes[i].name) - 1] = '\0';
+        strncpy(node->name, nodeName, PK_MAX_NAME_LEN - 1);
+        node->name[sizeof(node->name) - 1] = '\0';
+
+        if (gl_node->parent) {
+            node->parent = &nodes[remap[cgltf_node_index(data, gl_node->parent)]];
+        }
+        else {
+            node->parent = NULL;
+        }
 
         if (gl_node->has_translation) {
-            nodes[i].position = HMM_V3(gl_node->translation[0], gl_node->translation[1], gl_node->translation[2]);
+            node->position = HMM_V3(gl_node->translation[0], gl_node->translation[1], gl_node->translation[2]);
         }
         else {
-            nodes[i].position = HMM_V3(0.f, 0.f, 0.f);
+            node->position = HMM_V3(0.f, 0.f, 0.f);
         }
 
         if (gl_node->has_scale) {
-            nodes[i].scale = HMM_V3(gl_node->scale[0], gl_node->scale[1], gl_node->scale[2]);
+            node->scale = HMM_V3(gl_node->scale[0], gl_node->scale[1], gl_node->scale[2]);
         }
         else {
-            nodes[i].scale = HMM_V3(1.0f, 1.0f, 1.0f);
+            node->scale = HMM_V3(1.0f, 1.0f, 1.0f);
         }
 
         if (gl_node->has_rotation) {
-            nodes[i].rotation = HMM_Q(
+            node->rotation = HMM_Q(
                 gl_node->rotation[0],
                 gl_node->rotation[1],
                 gl_node->rotation[2],
@@ -919,65 +1852,54 @@ static pk_node* load_scene_nodes(pk_allocator* allocator, cgltf_data* data, size
             );
         }
         else {
-            nodes[i].rotation = HMM_Q(0.f, 0.f, 0.f, 1.0f);
+            node->rotation = HMM_Q(0.f, 0.f, 0.f, 1.0f);
         }
+        node->dirty = true;
     }
     return nodes;
 }
 
-static void organize_nodes(pk_allocator* allocator, cgltf_data* data, pk_node* nodes) {
-    size_t map_capacity = data->nodes_count * 2;
-    hashmap node_map = {0};
-    bool ok = _pk_hashmap_init(allocator, &node_map, sizeof(cgltf_node*), sizeof(pk_node), map_capacity);
-    pk_assert(ok);
-
-    for (size_t i = 0; i < data->nodes_count; ++i) {
-        const cgltf_node* gl_node = &data->nodes[i];
-        pk_node* current_node = &nodes[i];
-        hashmap_insert(&node_map, &gl_node, &current_node);
-    }
-    for (size_t i = 0; i < data->nodes_count; ++i) {
-        const cgltf_node* gl_node = &data->nodes[i];
-        pk_node* current_node = &nodes[i];
-        if (gl_node->parent) {
-            pk_node** parent_ptr = (pk_node**)hashmap_find(&node_map, &gl_node->parent);
-            current_node->parent = parent_ptr ? *parent_ptr : NULL;
-        } else {
-            current_node->parent = NULL;
-        }
-    }
-
-    pk_free(allocator, node_map.keys);
-    pk_free(allocator, node_map.values);
-    pk_free(allocator, node_map.used);
-}
-
 static pk_primitive create_primitive(
     pk_vertex_pnt* vertices, size_t vertex_count,
-    uint32_t* indices, size_t index_count) {
+    uint32_t* indices, size_t index_count, sg_index_type index_type,
+    pk_vertex_packed* packed, bool queue_upload) {
 
     stsvco_optimize(indices, (unsigned int)index_count, (unsigned int)vertex_count, 32);
 
     pk_primitive prim = {0};
     pk_primitive_desc desc = {0};
+    pk_quant_params_t quant = {0};
     desc.is_mutable = false;
     desc.num_elements = (int)index_count;
-    desc.vertices = (sg_range){ vertices, vertex_count * sizeof(pk_vertex_pnt) };
-    desc.indices = (sg_range){ indices, index_count * sizeof(uint32_t) };
+    if (packed) {
+        quant = pk_pack_vertices(vertices, packed, vertex_count);
+        desc.vertices = (sg_range){ packed, vertex_count * sizeof(pk_vertex_packed) };
+    } else {
+        desc.vertices = (sg_range){ vertices, vertex_count * sizeof(pk_vertex_pnt) };
+    }
+    desc.indices = _pk_index_range(indices, index_count, index_type);
+    desc.index_type = index_type;
+    desc.queue_upload = queue_upload;
     pk_init_primitive(&prim, &desc);
+    prim.packed = packed != NULL;
+    prim.quant = quant;
     return prim;
 }
 
 //--PUBLIC----------------------
 
-bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data) {
-    pk_assert(model && data);
-    size_t node_count;
-    pk_node* nodes = load_scene_nodes(allocator, data, &node_count);
-    organize_nodes(allocator, data, nodes);
-
-    model->nodes = nodes;
-    model->node_count = (uint16_t)node_count;
+bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data, const pk_gltf_desc* desc) {
+    pk_assert(model && data && desc);
+    pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_MODEL);
+    //temporaries come from a scratch arena on top of allocator, the per primitive ones get rewound
+    pk_arena scratch;
+    pk_init_arena(allocator, &scratch, 0);
+    pk_allocator scratch_alloc = pk_arena_allocator(&scratch);
+    size_t* node_remap = sort_scene_nodes(&scratch_alloc, data);
+    model->nodes = load_scene_nodes(allocator, data, node_remap);
+    model->node_count = (uint16_t)data->nodes_count;
+    model->world_matrices = (HMM_Mat4*)pk_alloc(allocator, sizeof(HMM_Mat4) * data->nodes_count);
+    pk_assert(model->world_matrices);
 
     pk_printf("Scene node info:");
     for (uint16_t i = 0; i < model->node_count; ++i) {
@@ -987,14 +1909,54 @@ bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data) {
         }
     }
 
-    pk_mesh* meshes = pk_alloc(allocator, data->meshes_count * sizeof(pk_mesh));
+    //every node with a mesh becomes a pk_mesh, so count them first
+    size_t mesh_count = 0;
+    size_t total_vertices = 0;
+    size_t total_indices = 0;
+    size_t max_vertices = 0;
+    for (size_t i = 0; i < data->nodes_count; ++i) {
+        const cgltf_mesh* gl_mesh = data->nodes[i].mesh;
+        if (!gl_mesh) continue;
+        mesh_count++;
+        for (size_t j = 0; j < gl_mesh->primitives_count; ++j) {
+            size_t vertex_count = interleave_attributes(&gl_mesh->primitives[j], NULL);
+            size_t index_count = load_indices(&gl_mesh->primitives[j], NULL);
+            if (vertex_count == 0 || index_count == 0) continue;
+            if (vertex_count > max_vertices) max_vertices = vertex_count;
+            total_vertices += vertex_count;
+            total_indices += index_count;
+        }
+    }
+
+    pk_mesh* meshes = pk_alloc(allocator, mesh_count * sizeof(pk_mesh));
     pk_assert(meshes);
     size_t mesh_idx = 0;
 
+    //for merged buffers, the primitives just get their sub range of these
+    const bool merge = desc->merge_buffers && total_vertices > 0 && total_indices > 0;
+    pk_vertex_pnt* merged_vertices = NULL;
+    pk_vertex_packed* merged_packed = NULL;
+    uint32_t* merged_indices = NULL;
+    size_t vertex_offset = 0;
+    size_t index_offset = 0;
+    //without base vertex support, offset the indices themselves
+    const bool rebase_indices = merge && !sg_query_features().draw_base_vertex;
+    //rebased indices address the whole merged buffer, otherwise only their own primitive
+    const sg_index_type index_type = _pk_index_type(rebase_indices ? total_vertices : max_vertices);
+    if (merge) {
+        merged_vertices = pk_alloc(&scratch_alloc, total_vertices * sizeof(pk_vertex_pnt));
+        merged_indices = pk_alloc(&scratch_alloc, total_indices * sizeof(uint32_t));
+        pk_assert(merged_vertices && merged_indices);
+        if (desc->packed_vertices) {
+            merged_packed = pk_alloc(&scratch_alloc, total_vertices * sizeof(pk_vertex_packed));
+            pk_assert(merged_packed);
+        }
+    }
+
     //process nodes and assign meshes/models in one loop
     for (size_t i = 0; i < data->nodes_count; ++i) {
         const cgltf_node* gl_node = &data->nodes[i];
-        pk_node* current_node = &model->nodes[i];
+        pk_node* current_node = &model->nodes[node_remap[i]];
 
         //process meshes attached to this node
         if (gl_node->mesh) {
@@ -1002,46 +1964,112 @@ bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data) {
             const cgltf_mesh* gl_mesh = gl_node->mesh;
             pk_primitive* primitives = pk_alloc(allocator, gl_node->mesh->primitives_count * sizeof(pk_primitive));
             pk_assert(primitives);
+            memset(primitives, 0, gl_node->mesh->primitives_count * sizeof(pk_primitive));
             //bool is_skinned = (gl_node->skin != NULL);
+            //empty primitives are left out, so every primitive of the mesh can be drawn
+            uint16_t prim_count = 0;
 
             for (size_t j = 0; j < gl_mesh->primitives_count; ++j) {
                 const cgltf_primitive* primitive = &gl_mesh->primitives[j];
 
-                size_t vertex_count;
-                pk_vertex_pnt* vertices = interleave_attributes(allocator, primitive, &vertex_count);
-                size_t index_count;
-                uint32_t* indices = load_indices(allocator, primitive, &index_count);
-
-                if (vertex_count > 0 && index_count > 0) {
-                    primitives[j] = create_primitive(vertices, vertex_count, indices, index_count);
-                    pk_free(allocator, vertices);
-                    pk_free(allocator, indices);
-                    /*
-                    if (is_skinned) {
-                        array_t<pk_vertex_skin> skin_verts = interleave_attributes_skin(primitive);
-                        sg_buffer_desc skin = {};
-                        skin.type = SG_BUFFERTYPE_VERTEXBUFFER;
-                        skin.usage = SG_USAGE_IMMUTABLE;
-                        skin.data = sg_range{ skin_verts.data, skin_verts.count * sizeof(pk_vertex_skin) };
-                        prim.bindings.vertex_buffers[1] = sg_make_buffer(skin);
-                    }
-                    */
-                }
-                else {
+                size_t vertex_count = interleave_attributes(primitive, NULL);
+                size_t index_count = load_indices(primitive, NULL);
+
+                if (vertex_count == 0 || index_count == 0) {
                     pk_printf("No vertices or indices found for mesh '%s'\n", gl_mesh->name ? gl_mesh->name : "Unnamed");
+                    continue;
                 }
 
+                if (merge) {
+                    pk_vertex_pnt* vertices = merged_vertices + vertex_offset;
+                    uint32_t* indices = merged_indices + index_offset;
+                    interleave_attributes(primitive, vertices);
+                    load_indices(primitive, indices);
+                    stsvco_optimize(indices, (unsigned int)index_count, (unsigned int)vertex_count, 32);
+                    if (rebase_indices) {
+                        for (size_t k = 0; k < index_count; ++k) {
+                            indices[k] += (uint32_t)vertex_offset;
+                        }
+                    } else {
+                        primitives[prim_count].base_vertex = (int)vertex_offset;
+                    }
+                    primitives[prim_count].base_element = (int)index_offset;
+                    primitives[prim_count].num_elements = (int)index_count;
+                    primitives[prim_count].index_type = index_type;
+                    if (merged_packed) {
+                        //every primitive gets its own bounds, even in the shared buffer
+                        primitives[prim_count].packed = true;
+                        primitives[prim_count].quant = pk_pack_vertices(vertices, merged_packed + vertex_offset, vertex_count);
+                    }
+                    vertex_offset += vertex_count;
+                    index_offset += index_count;
+                    //bindings get filled in, when the merged buffers exist
+                } else {
+                    pk_arena_mark mark = pk_arena_get_mark(&scratch);
+                    pk_vertex_pnt* vertices = pk_alloc(&scratch_alloc, vertex_count * sizeof(pk_vertex_pnt));
+                    uint32_t* indices = pk_alloc(&scratch_alloc, index_count * sizeof(uint32_t));
+                    pk_vertex_packed* packed = NULL;
+                    pk_assert(vertices && indices);
+                    if (desc->packed_vertices) {
+                        packed = pk_alloc(&scratch_alloc, vertex_count * sizeof(pk_vertex_packed));
+                        pk_assert(packed);
+                    }
+                    interleave_attributes(primitive, vertices);
+                    load_indices(primitive, indices);
+                    primitives[prim_count] = create_primitive(vertices, vertex_count, indices, index_count, index_type, packed, desc->queue_uploads);
+                    pk_rewind_arena(&scratch, mark);
+                }
+                prim_count++;
+                /*
+                if (is_skinned) {
+                    array_t<pk_vertex_skin> skin_verts = interleave_attributes_skin(primitive);
+                    sg_buffer_desc skin = {};
+                    skin.type = SG_BUFFERTYPE_VERTEXBUFFER;
+                    skin.usage = SG_USAGE_IMMUTABLE;
+                    skin.data = sg_range{ skin_verts.data, skin_verts.count * sizeof(pk_vertex_skin) };
+                    prim.bindings.vertex_buffers[1] = sg_make_buffer(skin);
+                }
+                */
             }
 
             meshes[mesh_idx].node = current_node;
             meshes[mesh_idx].primitives = primitives;
-            meshes[mesh_idx].primitive_count = (uint16_t)gl_mesh->primitives_count;
+            meshes[mesh_idx].primitive_count = prim_count;
             mesh_idx++;
         }
     }
 
+    if (merge) {
+        //all primitives share these, pk_release_primitive on an already destroyed buffer is a no-op
+        sg_buffer_desc vdesc = {
+            .usage = { .vertex_buffer = true, .immutable = true },
+            .data = merged_packed
+                ? (sg_range){ merged_packed, total_vertices * sizeof(pk_vertex_packed) }
+                : (sg_range){ merged_vertices, total_vertices * sizeof(pk_vertex_pnt) },
+        };
+        sg_buffer_desc idesc = {
+            .usage = { .index_buffer = true, .immutable = true },
+            .data = _pk_index_range(merged_indices, total_indices, index_type),
+        };
+        sg_buffer vbuf = desc->queue_uploads ? pk_queue_buffer_upload(&vdesc, NULL) : sg_make_buffer(&vdesc);
+        sg_buffer ibuf = desc->queue_uploads ? pk_queue_buffer_upload(&idesc, NULL) : sg_make_buffer(&idesc);
+        for (size_t i = 0; i < mesh_count; ++i) {
+            for (uint16_t j = 0; j < meshes[i].primitive_count; ++j) {
+                meshes[i].primitives[j].bindings.vertex_buffers[0] = vbuf;
+                meshes[i].primitives[j].bindings.index_buffer = ibuf;
+            }
+        }
+    }
+
+    pk_release_arena(&scratch);
+
     model->meshes = meshes;
-    model->mesh_count = (uint16_t)data->meshes_count;
+    model->mesh_count = (uint16_t)mesh_count;
+    model->index_type = index_type;
+    model->buffer_bytes = total_vertices * (desc->packed_vertices ? sizeof(pk_vertex_packed) : sizeof(pk_vertex_pnt))
+        + total_indices * (index_type == SG_INDEXTYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t));
+    pk_update_model_transforms(model);
+    pk_set_alloc_tag(tag);
     return true;
 }
 
@@ -1057,21 +2085,65 @@ pk_node* pk_find_model_node(const pk_model* model, const char* name) {
 }
 
 void pk_set_model_texture(pk_model* model, const pk_texture* tex, int slot) {
-    pk_assert(model && tex);
+    pk_assert(model && tex && slot < SG_MAX_TEXTURE_SAMPLER_PAIRS);
+    //one view for all primitives, so primitives in merged buffers end up with identical bindings
+    const bool shared = tex->view.id != SG_INVALID_ID;
+    sg_view view = shared ? tex->view : sg_make_view(&(sg_view_desc) {
+        .texture.image = tex->image,
+    });
     for (uint16_t i = 0; i < model->mesh_count; ++i) {
         pk_mesh* mesh = &model->meshes[i];
         for (uint16_t j = 0; j < mesh->primitive_count; j++) {
-            pk_texture_primitive(&mesh->primitives[j], tex, slot);
+            mesh->primitives[j].bindings.samplers[slot] = tex->sampler;
+            mesh->primitives[j].bindings.views[slot] = view;
+            if (shared) mesh->primitives[j].shared_views |= 1u << slot;
+            else mesh->primitives[j].shared_views &= ~(1u << slot);
+        }
+    }
+}
+
+void pk_update_model_transforms(pk_model* model) {
+    pk_assert(model);
+    //parents come first, so a dirty parent has already been updated, when we reach its children
+    for (uint16_t i = 0; i < model->node_count; ++i) {
+        pk_node* node = &model->nodes[i];
+        if (node->parent && node->parent->dirty) {
+            node->dirty = true;
+        }
+        if (!node->dirty) continue;
+
+        HMM_Mat4 local = pk_node_local_transform(node);
+        if (node->parent) {
+            model->world_matrices[i] = HMM_MulM4(model->world_matrices[node->parent - model->nodes], local);
+        } else {
+            model->world_matrices[i] = local;
         }
     }
+    for (uint16_t i = 0; i < model->node_count; ++i) {
+        model->nodes[i].dirty = false;
+    }
 }
 
 void pk_draw_model(pk_model* model, pk_vs_params_t* vs_params) {
     pk_assert(model && vs_params);
+    pk_update_model_transforms(model);
+    const sg_bindings* last_bind = NULL;
     for (uint16_t i = 0; i < model->mesh_count; ++i) {
         pk_mesh* mesh = &model->meshes[i];
-        vs_params->model = pk_node_transform(mesh->node);
-        pk_draw_mesh(mesh, vs_params);
+        vs_params->model = model->world_matrices[mesh->node - model->nodes];
+        _pk_draw_mesh_primitives(mesh, vs_params, NULL, &last_bind);
+    }
+}
+
+void pk_draw_model_instanced(pk_model* model, pk_vs_params_t* vs_params, const pk_instance_buffer* buf) {
+    pk_assert(model && vs_params && buf);
+    if (buf->count == 0) return;
+    pk_update_model_transforms(model);
+    const sg_bindings* last_bind = NULL;
+    for (uint16_t i = 0; i < model->mesh_count; ++i) {
+        pk_mesh* mesh = &model->meshes[i];
+        vs_params->model = model->world_matrices[mesh->node - model->nodes];
+        _pk_draw_mesh_primitives(mesh, vs_params, buf, &last_bind);
     }
 }
 
@@ -1080,9 +2152,161 @@ void pk_release_model(pk_allocator* allocator, pk_model* model) {
     for (uint16_t i = 0; i < model->mesh_count; ++i) {
         pk_mesh* mesh = &model->meshes[i];
         pk_release_mesh(mesh);
+        pk_free(allocator, mesh->primitives);
     }
     pk_free(allocator, model->meshes);
     pk_free(allocator, model->nodes);
+    pk_free(allocator, model->world_matrices);
+}
+
+bool pk_model_ready(const pk_model* model) {
+    pk_assert(model);
+    for (uint16_t i = 0; i < model->mesh_count; ++i) {
+        const pk_mesh* mesh = &model->meshes[i];
+        for (uint16_t j = 0; j < mesh->primitive_count; ++j) {
+            if (!pk_primitive_ready(&mesh->primitives[j])) return false;
+        }
+    }
+    return true;
+}
+
+
+//---------------------------------------------------------------------------------
+//--RENDER-QUEUE-------------------------------------------------------------------
+//---------------------------------------------------------------------------------
+
+
+#define RQ_DEF_CAPACITY (1024)
+
+//Sokol handles keep the pool slot index in the lower 16 bits and a generation counter above.
+//The key keeps only the slot, which always fits since sokol pools have at most 64k slots.
+//Live resources never share a slot, so items with the same state still sort next to each other.
+//The key only orders the queue, the flush compares the full ids before applying state.
+#define _PK_KEY_SLOT(id) ((uint64_t)((id) & 0xFFFF))
+
+static uint64_t _pk_draw_item_key(sg_pipeline pip, const pk_primitive* primitive) {
+    const sg_bindings* bind = &primitive->bindings;
+    return (_PK_KEY_SLOT(pip.id) << 48) |
+           (_PK_KEY_SLOT(bind->views[0].id) << 32) |
+           (_PK_KEY_SLOT(bind->vertex_buffers[0].id) << 16) |
+           _PK_KEY_SLOT(bind->index_buffer.id);
+}
+
+static int _pk_compare_draw_items(const void* a, const void* b) {
+    const uint64_t ka = ((const pk_draw_item*)a)->key;
+    const uint64_t kb = ((const pk_draw_item*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+void pk_init_render_queue(pk_allocator* allocator, pk_render_queue* queue, const pk_render_queue_desc* desc) {
+    pk_assert(queue && desc);
+    queue->capacity = PK_DEF(desc->capacity, RQ_DEF_CAPACITY);
+    queue->items = (pk_draw_item*)pk_alloc(allocator, sizeof(pk_draw_item) * queue->capacity);
+    pk_assert(queue->items);
+    queue->count = 0;
+    queue->pipeline_cb = desc->pipeline_cb;
+    queue->udata = desc->udata;
+    memset(&queue->stats, 0, sizeof(pk_render_stats));
+}
+
+void pk_release_render_queue(pk_allocator* allocator, pk_render_queue* queue) {
+    pk_assert(queue);
+    pk_free(allocator, queue->items);
+    queue->items = NULL;
+    queue->count = 0;
+    queue->capacity = 0;
+}
+
+void pk_queue_primitive(pk_render_queue* queue, sg_pipeline pip, const pk_primitive* primitive, const HMM_Mat4* model) {
+    pk_assert(queue && primitive && model);
+    if (queue->count >= queue->capacity) {
+        pk_printf("pk_render_queue is full, dropping draw item.\n");
+        return;
+    }
+    pk_draw_item* item = &queue->items[queue->count++];
+    item->key = _pk_draw_item_key(pip, primitive);
+    item->pipeline = pip;
+    item->primitive = primitive;
+    item->model = *model;
+}
+
+void pk_queue_mesh(pk_render_queue* queue, sg_pipeline pip, const pk_mesh* mesh) {
+    pk_assert(queue && mesh);
+    HMM_Mat4 model = pk_node_transform(mesh->node);
+    for (uint16_t i = 0; i < mesh->primitive_count; ++i) {
+        pk_queue_primitive(queue, pip, &mesh->primitives[i], &model);
+    }
+}
+
+void pk_queue_model(pk_render_queue* queue, sg_pipeline pip, pk_model* model) {
+    pk_assert(queue && model);
+    pk_update_model_transforms(model);
+    for (uint16_t i = 0; i < model->mesh_count; ++i) {
+        const pk_mesh* mesh = &model->meshes[i];
+        const HMM_Mat4* world = &model->world_matrices[mesh->node - model->nodes];
+        for (uint16_t j = 0; j < mesh->primitive_count; ++j) {
+            pk_queue_primitive(queue, pip, &mesh->primitives[j], world);
+        }
+    }
+}
+
+void pk_flush_render_queue(pk_render_queue* queue, pk_vs_params_t* vs_params) {
+    pk_assert(queue && vs_params);
+    pk_render_stats stats = {0};
+    qsort(queue->items, (size_t)queue->count, sizeof(pk_draw_item), _pk_compare_draw_items);
+
+    uint32_t cur_pip = SG_INVALID_ID;
+    sg_index_type cur_index_type = SG_INDEXTYPE_NONE;
+    const sg_bindings* cur_bind = NULL;
+    const HMM_Mat4* cur_model = NULL;
+
+    for (int i = 0; i < queue->count; ++i) {
+        const pk_draw_item* item = &queue->items[i];
+        const pk_primitive* primitive = item->primitive;
+
+        if (item->pipeline.id != cur_pip) {
+            sg_apply_pipeline(item->pipeline);
+            if (queue->pipeline_cb) {
+                queue->pipeline_cb(item->pipeline, queue->udata);
+            }
+            cur_pip = item->pipeline.id;
+#ifndef NDEBUG
+            cur_index_type = sg_query_pipeline_desc(item->pipeline).index_type;
+#endif
+            //bindings and uniforms have to be applied again after a pipeline switch
+            cur_bind = NULL;
+            cur_model = NULL;
+            stats.pipeline_applies++;
+        } else {
+            stats.pipeline_skips++;
+        }
+
+        pk_assert(cur_index_type == primitive->index_type && "pipeline index type doesn't match the primitive");
+        (void)cur_index_type;
+
+        if (cur_bind == NULL || memcmp(cur_bind, &primitive->bindings, sizeof(sg_bindings)) != 0) {
+            sg_apply_bindings(&primitive->bindings);
+            cur_bind = &primitive->bindings;
+            stats.bindings_applies++;
+        } else {
+            stats.bindings_skips++;
+        }
+
+        if (cur_model == NULL || memcmp(cur_model, &item->model, sizeof(HMM_Mat4)) != 0) {
+            vs_params->model = item->model;
+            sg_apply_uniforms(UB_pk_vs_params, &(sg_range){vs_params, sizeof(pk_vs_params_t)});
+            cur_model = &item->model;
+            stats.uniforms_applies++;
+        } else {
+            stats.uniforms_skips++;
+        }
+
+        _pk_draw_elements(primitive, 1);
+        stats.draws++;
+    }
+
+    queue->count = 0;
+    queue->stats = stats;
 }
 
 
@@ -1098,22 +2322,40 @@ static pk_gltf_anim_interp_type get_interpolation_type(cgltf_interpolation_type
     case cgltf_interpolation_type_step:
         return PK_ANIM_INTERP_STEP;
     case cgltf_interpolation_type_cubic_spline:
-        //force cubic spline to linear
-        return PK_ANIM_INTERP_LINEAR;
+        return PK_ANIM_INTERP_CUBIC;
     default:
         return PK_ANIM_INTERP_LINEAR;
     }
 }
 
-static void extract_animation_channel(
-    pk_allocator* allocator,
+//3 for translation/scale and 4 for rotation.
+static int _pk_anim_components(pk_gltf_anim_path_type path) {
+    return path == PK_ANIM_PATH_ROTATION ? 4 : 3;
+}
+
+//floats per keyframe in pk_gltf_anim_channel.values, cubic keys also hold their two tangents
+static int _pk_anim_value_stride(pk_gltf_anim_path_type path, pk_gltf_anim_interp_type interpolation) {
+    return _pk_anim_components(path) * (interpolation == PK_ANIM_INTERP_CUBIC ? 3 : 1);
+}
+
+//floats per keyframe of a gltf channel, before it is known whether the channel is kept
+static size_t _pk_gltf_key_floats(const cgltf_animation_channel* channel) {
+    const size_t components = channel->target_path == cgltf_animation_path_type_rotation ? 4 : 3;
+    return 1 + components * (channel->sampler->interpolation == cgltf_interpolation_type_cubic_spline ? 3 : 1);
+}
+
+//Reads the times and values of a channel into keys, returns the number of floats used.
+//0 means the channel is skipped.
+static size_t extract_animation_channel(
     cgltf_animation_channel* gltf_channel,
     pk_gltf_anim_channel* pk_channel,
+    float* keys,
     pk_model* model, cgltf_data* data) {
 
-    pk_channel->target_node = pk_find_model_node(model, gltf_channel->target_node->name);
-    if (!pk_channel->target_node)
-        return;
+    pk_node* target_node = pk_find_model_node(model, gltf_channel->target_node->name);
+    if (!target_node)
+        return 0;
+    pk_channel->target_node = (int)(target_node - model->nodes);
 
     //Determine which property is animated.
     switch (gltf_channel->target_path) {
@@ -1127,73 +2369,86 @@ static void extract_animation_channel(
         pk_channel->path = PK_ANIM_PATH_SCALE;
         break;
     default:
-        return;
+        return 0;
     }
 
     int num_keyframes = (int)gltf_channel->sampler->input->count;
+    int components = _pk_anim_components(pk_channel->path);
+    pk_channel->interpolation = get_interpolation_type(gltf_channel->sampler->interpolation);
     pk_channel->num_keyframes = num_keyframes;
-
-    pk_channel->keyframes = (pk_gltf_keyframe*)pk_alloc(allocator, sizeof(pk_gltf_keyframe) * num_keyframes);
-    pk_assert(pk_channel->keyframes);
-
-    //Determine the number of components expected.
-    //Even if the sampler is cubic spline, we force linear so we expect
-    //3 for translation/scale and 4 for rotation.
-    cgltf_size components = (pk_channel->path == PK_ANIM_PATH_ROTATION) ? 4 : 3;
+    pk_channel->times = keys;
+    pk_channel->values = keys + num_keyframes;
 
     for (int i = 0; i < num_keyframes; ++i) {
-        pk_channel->keyframes[i].time = 0.0f;
-
-        cgltf_accessor_read_float(gltf_channel->sampler->input, i,
-            &pk_channel->keyframes[i].time, 1);
-
-        pk_channel->keyframes[i].value = (float*)pk_alloc(allocator, sizeof(float) * components);
-        pk_assert(pk_channel->keyframes[i].value);
+        pk_channel->times[i] = 0.0f;
+        cgltf_accessor_read_float(gltf_channel->sampler->input, i, &pk_channel->times[i], 1);
+    }
+    //cubic samplers have three outputs per key, which are already in the in-tangent, value, out-tangent order
+    int num_values = num_keyframes * _pk_anim_value_stride(pk_channel->path, pk_channel->interpolation) / components;
+    for (int i = 0; i < num_values; ++i) {
         cgltf_accessor_read_float(gltf_channel->sampler->output, i,
-            pk_channel->keyframes[i].value, components);
-
+            &pk_channel->values[i * components], components);
     }
-
-    pk_channel->interpolation = get_interpolation_type(gltf_channel->sampler->interpolation);
+    return (size_t)num_keyframes + (size_t)num_values * components;
 }
 
 static void load_gltf_animations(pk_allocator* allocator, cgltf_data* data, pk_gltf_anim* target, pk_model* model) {
-    target->num_channels = 0;
-    target->duration = 0;
+    memset(target, 0, sizeof(pk_gltf_anim));
 
-    //Count total animation channels.
+    //Count total animation channels and the floats of their keyframes.
+    //Skipped channels (unknown target or path) reserve space too, which keeps the count simple.
+    int max_channels = 0;
+    size_t num_keys = 0;
     for (int i = 0; i < data->animations_count; ++i) {
         cgltf_animation* anim = &data->animations[i];
-        target->num_channels += (int)anim->channels_count;
+        max_channels += (int)anim->channels_count;
+        for (int j = 0; j < anim->channels_count; ++j) {
+            num_keys += anim->channels[j].sampler->input->count * _pk_gltf_key_floats(&anim->channels[j]);
+        }
     }
 
-    target->channels = (pk_gltf_anim_channel*)pk_alloc(allocator, target->num_channels * sizeof(pk_gltf_anim_channel));
+    target->num_clips = (int)data->animations_count;
+    target->clips = (pk_gltf_anim_clip*)pk_alloc(allocator, target->num_clips * sizeof(pk_gltf_anim_clip));
+    pk_assert(target->clips);
+    memset(target->clips, 0, target->num_clips * sizeof(pk_gltf_anim_clip));
+    target->channels = (pk_gltf_anim_channel*)pk_alloc(allocator, PK_DEF(max_channels, 1) * sizeof(pk_gltf_anim_channel));
     pk_assert(target->channels);
+    target->keys = (float*)pk_alloc(allocator, PK_DEF(num_keys, 1) * sizeof(float));
+    pk_assert(target->keys);
 
-    int channel_index = 0;
+    size_t key_offset = 0;
     for (int i = 0; i < data->animations_count; ++i) {
         cgltf_animation* anim = &data->animations[i];
+        pk_gltf_anim_clip* clip = &target->clips[i];
+        if (anim->name) {
+            strncpy(clip->name, anim->name, PK_MAX_NAME_LEN - 1);
+        }
+        clip->first_channel = target->num_channels;
         for (int j = 0; j < anim->channels_count; ++j) {
             cgltf_animation_channel* gltf_channel = &anim->channels[j];
-            pk_gltf_anim_channel* pk_channel = &target->channels[channel_index++];
-            extract_animation_channel(allocator, gltf_channel, pk_channel, model, data);
-            //Update the overall duration.
-            for (int k = 0; k < pk_channel->num_keyframes; ++k) {
-                if (pk_channel->keyframes[k].time > target->duration) {
-                    target->duration = pk_channel->keyframes[k].time;
-                }
+            pk_gltf_anim_channel* pk_channel = &target->channels[target->num_channels];
+            size_t floats = extract_animation_channel(gltf_channel, pk_channel, target->keys + key_offset, model, data);
+            if (floats == 0) continue;
+            key_offset += floats;
+            target->num_channels++;
+            //The clip lasts until its last keyframe.
+            float last = pk_channel->times[pk_channel->num_keyframes - 1];
+            if (last > clip->duration) {
+                clip->duration = last;
             }
         }
+        clip->num_channels = target->num_channels - clip->first_channel;
     }
+    pk_assert(key_offset <= num_keys);
 
-    target->elapsed_time = 0.0f;
-    target->loop = true;
     target->ready = true;
 }
 
 bool pk_load_gltf_anim(pk_allocator* allocator, pk_gltf_anim* anim, pk_model* model, cgltf_data* data) {
     if (data->animations_count > 0) {
+        pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_ANIM);
         load_gltf_animations(allocator, data, anim, model);
+        pk_set_alloc_tag(tag);
         return true;
     }
     else {
@@ -1202,99 +2457,270 @@ bool pk_load_gltf_anim(pk_allocator* allocator, pk_gltf_anim* anim, pk_model* mo
     }
 }
 
-static void find_keyframes(float time, pk_gltf_anim_channel* channel, int* key1, int* key2, float* t) {
-    int num_keyframes = channel->num_keyframes;
-    for (int i = 0; i < num_keyframes - 1; ++i) {
-        if (time >= channel->keyframes[i].time && time <= channel->keyframes[i + 1].time) {
-            *key1 = i;
-            *key2 = i + 1;
-            float time1 = channel->keyframes[i].time;
-            float time2 = channel->keyframes[i + 1].time;
-            *t = (time - time1) / (time2 - time1);
-            return;
+#define PK_ANIM_CURSOR_STEPS (4)
+
+//largest i with times[i] <= time, for times[0] <= time < times[count - 1]
+static int _pk_search_keyframe(const float* times, int count, float time) {
+    int lo = 0, hi = count - 1;
+    while (hi - lo > 1) {
+        int mid = lo + (hi - lo) / 2;
+        if (times[mid] <= time) lo = mid;
+        else hi = mid;
+    }
+    return lo;
+}
+
+//Time mostly moves forward by less than a keyframe per frame, so the search starts at the cursor
+//of the last call. Seeks, loops and big steps fall back to a binary search.
+static void find_keyframes(float time, const pk_gltf_anim_channel* channel, int cursor, int* key1, int* key2, float* t) {
+    const float* times = channel->times;
+    const int last = channel->num_keyframes - 1;
+    //clamp to the first or last keyframe, if time is outside the range
+    if (last <= 0 || time <= times[0]) {
+        *key1 = *key2 = 0;
+        *t = 0.0f;
+        return;
+    }
+    if (time >= times[last]) {
+        *key1 = *key2 = last;
+        *t = 0.0f;
+        return;
+    }
+
+    int i = cursor;
+    if (i < 0 || i >= last || time < times[i]) {
+        i = _pk_search_keyframe(times, channel->num_keyframes, time);
+    } else {
+        int steps = 0;
+        while (time >= times[i + 1]) {
+            if (++steps > PK_ANIM_CURSOR_STEPS) {
+                i = _pk_search_keyframe(times + i, channel->num_keyframes - i, time) + i;
+                break;
+            }
+            i++;
         }
     }
-    //Clamp to the last keyframe if time is beyond the range.
-    *key1 = num_keyframes - 1;
-    *key2 = num_keyframes - 1;
-    *t = 0.0f;
+    *key1 = i;
+    *key2 = i + 1;
+    *t = (time - times[i]) / (times[i + 1] - times[i]);
 }
 
-static void interpolate_animation(pk_gltf_anim_channel* channel, float current_time) {
-    pk_assert(channel);
+//Hermite spline between the values of two cubic keys, dt is the time between the keys.
+static void _pk_hermite(const float* key1, const float* key2, int components, float dt, float t, float* result) {
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    const float h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+    const float h10 = (t3 - 2.0f * t2 + t) * dt;
+    const float h01 = -2.0f * t3 + 3.0f * t2;
+    const float h11 = (t3 - t2) * dt;
+    const float* value1 = key1 + components;
+    const float* out1 = key1 + 2 * components;
+    const float* in2 = key2;
+    const float* value2 = key2 + components;
+    for (int i = 0; i < components; ++i) {
+        result[i] = h00 * value1[i] + h10 * out1[i] + h01 * value2[i] + h11 * in2[i];
+    }
+}
+
+//Writes 3 floats, 4 for rotations, to result. cursor is optional.
+static bool interpolate_animation(const pk_gltf_anim_channel* channel, int* cursor, float current_time, float* result) {
+    pk_assert(channel && result);
+    if (channel->num_keyframes == 0) return false;
     int key1 = 0, key2 = 0;
     float t = 0.f;
-    find_keyframes(current_time, channel, &key1, &key2, &t);
+    find_keyframes(current_time, channel, cursor ? *cursor : -1, &key1, &key2, &t);
+    if (cursor) {
+        *cursor = key1;
+    }
 
     //For STEP interpolation, use the first keyframe's value.
     if (channel->interpolation == PK_ANIM_INTERP_STEP) {
         t = 0.0f;
     }
 
-    pk_gltf_keyframe* kf1 = &channel->keyframes[key1];
-    pk_gltf_keyframe* kf2 = &channel->keyframes[key2];
-
+    const int components = _pk_anim_components(channel->path);
+    const int stride = _pk_anim_value_stride(channel->path, channel->interpolation);
+    const float* v1 = &channel->values[key1 * stride];
+    const float* v2 = &channel->values[key2 * stride];
+
+    if (channel->interpolation == PK_ANIM_INTERP_CUBIC) {
+        _pk_hermite(v1, v2, components, channel->times[key2] - channel->times[key1], t, result);
+        if (channel->path == PK_ANIM_PATH_ROTATION) {
+            //spline rotations are not unit length between the keys
+            HMM_Quat rot = HMM_NormQ(HMM_Q(result[0], result[1], result[2], result[3]));
+            memcpy(result, &rot, sizeof(rot));
+        }
+    } else if (channel->path == PK_ANIM_PATH_ROTATION) {
+        HMM_Quat rot1 = HMM_Q(v1[0], v1[1], v1[2], v1[3]);
+        HMM_Quat rot2 = HMM_Q(v2[0], v2[1], v2[2], v2[3]);
+        HMM_Quat rot = HMM_SLerp(rot1, t, rot2);
+        memcpy(result, &rot, sizeof(rot));
+    } else {
+        for (int i = 0; i < components; ++i) {
+            result[i] = HMM_Lerp(v1[i], t, v2[i]);
+        }
+    }
+    return true;
+}
 
-    switch(channel->path) {
-        case PK_ANIM_PATH_TRANSLATION: {
-            float result[3] = { 0  };
-            for (int i = 0; i < 3; ++i) {
-                result[i] = HMM_Lerp(kf1->value[i], t, kf2->value[i]);
-            }
-            channel->target_node->position = HMM_V3(result[0], result[1], result[2]);
-        } break;
-        case PK_ANIM_PATH_ROTATION: {
-                HMM_Quat rot1 = HMM_Q(kf1->value[0], kf1->value[1], kf1->value[2], kf1->value[3]);
-                HMM_Quat rot2 = HMM_Q(kf2->value[0], kf2->value[1], kf2->value[2], kf2->value[3]);
-                channel->target_node->rotation = HMM_SLerp(rot1, t, rot2);
-            } break;
-        case PK_ANIM_PATH_SCALE: {
-            float result[3] = { 0 };
-            for (int i = 0; i < 3; ++i) {
-                result[i] = HMM_Lerp(kf1->value[i], t, kf2->value[i]);
-            }
-            channel->target_node->scale = HMM_V3(result[0], result[1], result[2]);
-        } break;
-        default: break;
+//Advances the state, returns the clip to sample or NULL.
+static const pk_gltf_anim_clip* _pk_advance_gltf_anim(const pk_gltf_anim* anim, pk_gltf_anim_state* state, float dt) {
+    if (!anim->ready || state->clip < 0 || state->clip >= anim->num_clips) return NULL;
+    const pk_gltf_anim_clip* clip = &anim->clips[state->clip];
+    pk_assert(clip->num_channels <= state->num_cursors);
+    state->time += dt;
+    if (state->loop && clip->duration > 0.0f) {
+        state->time = fmodf(state->time, clip->duration);
+    }
+    else if (state->time > clip->duration) {
+        state->time = clip->duration;
     }
+    return clip;
 }
 
 //--PUBLIC--------------------------------------------------
 
-void pk_play_gltf_anim(pk_gltf_anim* animation, float dt) {
-    pk_assert(animation);
-    if (!animation->ready) return;
-    animation->elapsed_time += dt;
-    if (animation->loop) {
-        animation->elapsed_time = fmodf(animation->elapsed_time, animation->duration);
+int pk_find_gltf_anim_clip(const pk_gltf_anim* anim, const char* name) {
+    pk_assert(anim && name);
+    for (int i = 0; i < anim->num_clips; ++i) {
+        if (strcmp(anim->clips[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void pk_init_gltf_anim_state(pk_allocator* allocator, pk_gltf_anim_state* state, const pk_gltf_anim* anim) {
+    pk_assert(allocator && state && anim);
+    memset(state, 0, sizeof(pk_gltf_anim_state));
+    for (int i = 0; i < anim->num_clips; ++i) {
+        if (anim->clips[i].num_channels > state->num_cursors) {
+            state->num_cursors = anim->clips[i].num_channels;
+        }
     }
-    else if (animation->elapsed_time > animation->duration) {
-        animation->elapsed_time = animation->duration;
+    state->cursors = (int*)pk_alloc(allocator, sizeof(int) * PK_DEF(state->num_cursors, 1));
+    pk_assert(state->cursors);
+    memset(state->cursors, 0, sizeof(int) * PK_DEF(state->num_cursors, 1));
+}
+
+void pk_release_gltf_anim_state(pk_allocator* allocator, pk_gltf_anim_state* state) {
+    pk_assert(state);
+    pk_free(allocator, state->cursors);
+    memset(state, 0, sizeof(pk_gltf_anim_state));
+}
+
+void pk_play_gltf_anim(const pk_gltf_anim* anim, pk_gltf_anim_state* state, pk_model* model, float dt) {
+    pk_assert(anim && state && model);
+    const pk_gltf_anim_clip* clip = _pk_advance_gltf_anim(anim, state, dt);
+    if (!clip) return;
+
+    for (int i = 0; i < clip->num_channels; ++i) {
+        const pk_gltf_anim_channel* channel = &anim->channels[clip->first_channel + i];
+        pk_assert(channel->target_node < model->node_count);
+        float r[4];
+        if (!interpolate_animation(channel, &state->cursors[i], state->time, r)) continue;
+        pk_node* node = &model->nodes[channel->target_node];
+        switch (channel->path) {
+            case PK_ANIM_PATH_TRANSLATION: node->position = HMM_V3(r[0], r[1], r[2]); break;
+            case PK_ANIM_PATH_ROTATION: node->rotation = HMM_Q(r[0], r[1], r[2], r[3]); break;
+            case PK_ANIM_PATH_SCALE: node->scale = HMM_V3(r[0], r[1], r[2]); break;
+            default: break;
+        }
+        node->dirty = true;
     }
+}
 
-    for (int i = 0; i < animation->num_channels; ++i) {
-        pk_gltf_anim_channel* channel = &animation->channels[i];
-        if (channel->target_node) {
-            interpolate_animation(channel, animation->elapsed_time);
+void pk_sample_gltf_anim(const pk_gltf_anim* anim, pk_gltf_anim_state* state, pk_gltf_pose* pose, float dt) {
+    pk_assert(anim && state && pose);
+    const pk_gltf_anim_clip* clip = _pk_advance_gltf_anim(anim, state, dt);
+    if (!clip) return;
+
+    for (int i = 0; i < clip->num_channels; ++i) {
+        const pk_gltf_anim_channel* channel = &anim->channels[clip->first_channel + i];
+        const int node = channel->target_node;
+        pk_assert(node < pose->num_nodes);
+        float r[4];
+        if (!interpolate_animation(channel, &state->cursors[i], state->time, r)) continue;
+        switch (channel->path) {
+            case PK_ANIM_PATH_TRANSLATION: pose->translations[node] = HMM_V3(r[0], r[1], r[2]); break;
+            case PK_ANIM_PATH_ROTATION: pose->rotations[node] = HMM_Q(r[0], r[1], r[2], r[3]); break;
+            case PK_ANIM_PATH_SCALE: pose->scales[node] = HMM_V3(r[0], r[1], r[2]); break;
+            default: break;
         }
     }
 }
 
+void pk_init_gltf_pose(pk_allocator* allocator, pk_gltf_pose* pose, const pk_model* model) {
+    pk_assert(allocator && pose && model);
+    const int num_nodes = model->node_count;
+    //one block, rotations first so they keep the alignment of the allocation
+    const size_t rotations_size = sizeof(HMM_Quat) * num_nodes;
+    const size_t vectors_size = sizeof(HMM_Vec3) * num_nodes;
+    uint8_t* block = (uint8_t*)pk_alloc(allocator, PK_DEF(2 * rotations_size + 4 * vectors_size, 1));
+    pk_assert(block);
+    pose->rotations = (HMM_Quat*)block;
+    pose->rest_rotations = (HMM_Quat*)(block + rotations_size);
+    block += 2 * rotations_size;
+    pose->translations = (HMM_Vec3*)block;
+    pose->scales = (HMM_Vec3*)(block + vectors_size);
+    pose->rest_translations = (HMM_Vec3*)(block + 2 * vectors_size);
+    pose->rest_scales = (HMM_Vec3*)(block + 3 * vectors_size);
+    pose->num_nodes = num_nodes;
+    for (int i = 0; i < num_nodes; ++i) {
+        pose->rest_translations[i] = model->nodes[i].position;
+        pose->rest_rotations[i] = model->nodes[i].rotation;
+        pose->rest_scales[i] = model->nodes[i].scale;
+    }
+    pk_reset_gltf_pose(pose);
+}
+
+void pk_release_gltf_pose(pk_allocator* allocator, pk_gltf_pose* pose) {
+    pk_assert(pose);
+    pk_free(allocator, pose->rotations);
+    memset(pose, 0, sizeof(pk_gltf_pose));
+}
+
+void pk_reset_gltf_pose(pk_gltf_pose* pose) {
+    pk_assert(pose);
+    memcpy(pose->translations, pose->rest_translations, sizeof(HMM_Vec3) * pose->num_nodes);
+    memcpy(pose->rotations, pose->rest_rotations, sizeof(HMM_Quat) * pose->num_nodes);
+    memcpy(pose->scales, pose->rest_scales, sizeof(HMM_Vec3) * pose->num_nodes);
+}
+
+void pk_blend_gltf_poses(pk_gltf_pose* pose_a, const pk_gltf_pose* pose_b, float weight) {
+    pk_assert(pose_a && pose_b && pose_a->num_nodes == pose_b->num_nodes);
+    const int num_nodes = pose_a->num_nodes;
+    for (int i = 0; i < num_nodes; ++i) {
+        pose_a->translations[i] = HMM_LerpV3(pose_a->translations[i], weight, pose_b->translations[i]);
+    }
+    for (int i = 0; i < num_nodes; ++i) {
+        pose_a->rotations[i] = HMM_SLerp(pose_a->rotations[i], weight, pose_b->rotations[i]);
+    }
+    for (int i = 0; i < num_nodes; ++i) {
+        pose_a->scales[i] = HMM_LerpV3(pose_a->scales[i], weight, pose_b->scales[i]);
+    }
+}
+
+void pk_apply_gltf_pose(pk_model* model, const pk_gltf_pose* pose) {
+    pk_assert(model && pose && pose->num_nodes == model->node_count);
+    for (int i = 0; i < pose->num_nodes; ++i) {
+        pk_node* node = &model->nodes[i];
+        node->position = pose->translations[i];
+        node->rotation = pose->rotations[i];
+        node->scale = pose->scales[i];
+        node->dirty = true;
+    }
+}
+
 void pk_release_gltf_anim(pk_allocator* allocator, pk_gltf_anim* anim) {
     pk_assert(anim);
-    for (int i = 0; i < anim->num_channels; ++i) {
-        pk_gltf_anim_channel* channel = &anim->channels[i];
-        pk_assert(channel);
-        for (int j = 0; j < channel->num_keyframes; ++j) {
-            if (channel->keyframes[j].value != NULL) {
-                pk_free(allocator, channel->keyframes[j].value);
-            }
-        }
-        if (channel->keyframes != NULL) {
-            pk_free(allocator, channel->keyframes);
-        }
+    if (anim->keys != NULL) {
+        pk_free(allocator, anim->keys);
     }
     pk_free(allocator, anim->channels);
+    if (anim->clips != NULL) {
+        pk_free(allocator, anim->clips);
+    }
 }
 
 
@@ -1336,6 +2762,7 @@ bool pk_load_bone_anims(pk_allocator* allocator, pk_bone_anim_set* set, m3d_t* m
     }
 
     set->bone_count = m3d->numbone + 1;
+    pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_ANIM);
     set->bones = pk_alloc(allocator, set->bone_count * sizeof(pk_bone));
     pk_assert(set->bones);
     memset(set->bones, 0, sizeof(pk_bone) * set->bone_count);
@@ -1425,6 +2852,7 @@ bool pk_load_bone_anims(pk_allocator* allocator, pk_bone_anim_set* set, m3d_t* m
             }
         }
     }
+    pk_set_alloc_tag(tag);
     return true;
 }
 
@@ -1552,29 +2980,289 @@ void pk_release_bone_anims(pk_allocator* allocator, pk_bone_anim_set* set) {
 
 
 //--------------------------------------------------------------------------
-//--IMAGE-LOADING-----------------------------------------------------------
+//--FETCH-BUFFERS-----------------------------------------------------------
 //--------------------------------------------------------------------------
 
-typedef struct {
-    pk_image_loaded_callback loaded_cb;
-    pk_fail_callback fail_cb;
-    void* udata;
-} image_request_data;
 
-// from https://github.com/phoboslab/qoi/blob/master/qoiconv.c
-#define ENDS_WITH(str, end) (strcmp(str + strlen(str) - (sizeof(end)-1), end) == 0)
+//buffers bound on dispatch, so only the requests in flight hold one
+typedef struct _pk_fetch_buffer {
+    struct _pk_fetch_buffer* next;
+    void* ptr;
+} _pk_fetch_buffer;
+
+static _pk_fetch_buffer* _pk_fetch_buffers;
+
+void pk_manage_fetch_buffer(const sfetch_response_t* response) {
+    if (response->dispatched && !response->buffer.ptr) {
+        _pk_fetch_buffer* buffer = (_pk_fetch_buffer*)pk_alloc(pk_get_allocator(), sizeof(_pk_fetch_buffer));
+        pk_assert(buffer);
+        buffer->ptr = pk_alloc(pk_get_allocator(), _pk_fetch_buffer_size);
+        pk_assert(buffer->ptr);
+        buffer->next = _pk_fetch_buffers;
+        _pk_fetch_buffers = buffer;
+        sfetch_bind_buffer(response->handle, (sfetch_range_t){ buffer->ptr, _pk_fetch_buffer_size });
+    } else if (response->finished && response->buffer.ptr) {
+        for (_pk_fetch_buffer** it = &_pk_fetch_buffers; *it; it = &(*it)->next) {
+            if ((*it)->ptr == response->buffer.ptr) {
+                _pk_fetch_buffer* buffer = *it;
+                *it = buffer->next;
+                pk_free(pk_get_allocator(), buffer->ptr);
+                pk_free(pk_get_allocator(), buffer);
+                break;
+            }
+        }
+    }
+}
 
-static sg_pixel_format _pk_dds_to_sg_pixelformt(ddsktx_format fmt) {
-    switch(fmt) {
-        case DDSKTX_FORMAT_BC1:     return SG_PIXELFORMAT_BC1_RGBA; break;
-        case DDSKTX_FORMAT_BC2:     return SG_PIXELFORMAT_BC2_RGBA; break;
-        case DDSKTX_FORMAT_BC3:     return SG_PIXELFORMAT_BC3_RGBA; break;
-        case DDSKTX_FORMAT_BC4:     return SG_PIXELFORMAT_BC4_R; break;
-        case DDSKTX_FORMAT_BC5:     return SG_PIXELFORMAT_BC5_RG; break;
-        case DDSKTX_FORMAT_BC6H:    return SG_PIXELFORMAT_BC6H_RGBF; break;
-        case DDSKTX_FORMAT_BC7:     return SG_PIXELFORMAT_BC7_RGBA; break;
-        case DDSKTX_FORMAT_A8:
-        case DDSKTX_FORMAT_R8:      return SG_PIXELFORMAT_R8; break;
+//Takes a buffer bound by pk_manage_fetch_buffer away from it, the caller frees it.
+//NULL for buffers the request brought along.
+static void* _pk_take_fetch_buffer(const sfetch_response_t* response) {
+    for (_pk_fetch_buffer** it = &_pk_fetch_buffers; *it; it = &(*it)->next) {
+        if ((*it)->ptr == response->buffer.ptr) {
+            _pk_fetch_buffer* buffer = *it;
+            void* ptr = buffer->ptr;
+            *it = buffer->next;
+            pk_free(pk_get_allocator(), buffer);
+            return ptr;
+        }
+    }
+    return NULL;
+}
+
+//sfetch_shutdown drops the requests in flight without a callback
+static void _pk_fetch_buffers_shutdown(void) {
+    while (_pk_fetch_buffers) {
+        _pk_fetch_buffer* buffer = _pk_fetch_buffers;
+        _pk_fetch_buffers = buffer->next;
+        pk_free(pk_get_allocator(), buffer->ptr);
+        pk_free(pk_get_allocator(), buffer);
+    }
+}
+
+
+//--------------------------------------------------------------------------
+//--DECODE-WORKERS----------------------------------------------------------
+//--------------------------------------------------------------------------
+
+/*
+The fetch callbacks hand the fetched bytes to a job, which a worker decodes.
+Finished jobs wait until pk_dowork, which runs their callbacks on the calling thread.
+Workers sleep on a condition variable while the queue is empty.
+*/
+
+#define PK_MAX_DECODE_THREADS (16)
+
+#if defined(__EMSCRIPTEN__) && !defined(PK_NO_DECODE_THREADS)
+#define PK_NO_DECODE_THREADS
+#endif
+
+typedef struct _pk_decode_job _pk_decode_job;
+typedef void (*_pk_job_fn)(_pk_decode_job* job);
+
+struct _pk_decode_job {
+    _pk_decode_job* next;
+    _pk_job_fn decode;   //runs on a worker
+    _pk_job_fn complete; //runs in pk_dowork
+    _pk_job_fn discard;  //releases the result of a finished job, which pk_shutdown drops
+    sfetch_response_t response; //copy of the fetch response, pointing into the job
+    char path[SFETCH_MAX_PATH];
+    uint64_t user_data[SFETCH_MAX_USERDATA_UINT64];
+    void* bytes; //the fetch buffer or a copy, freed with the job, unless the result took it over
+    pk_alloc_tag tag;
+    bool ok;
+    union {
+        sg_image_desc image;
+        m3d_t* m3d;
+        cgltf_data* gltf;
+    } result;
+};
+
+typedef struct {
+    _pk_decode_job* head;
+    _pk_decode_job* tail;
+} _pk_job_list;
+
+static struct {
+    mt_mutex lock;
+    mt_cond wake; //signalled when a job is queued and on shutdown
+    mt_thread threads[PK_MAX_DECODE_THREADS];
+    int num_threads;
+    mt_atomic_int32 running;
+    _pk_job_list pending;
+    _pk_job_list done;
+} _pk_decode;
+
+static void _pk_job_push(_pk_job_list* list, _pk_decode_job* job) {
+    job->next = NULL;
+    if (list->tail) list->tail->next = job;
+    else list->head = job;
+    list->tail = job;
+}
+
+static _pk_decode_job* _pk_job_pop(_pk_job_list* list) {
+    _pk_decode_job* job = list->head;
+    if (job) {
+        list->head = job->next;
+        if (!list->head) list->tail = NULL;
+    }
+    return job;
+}
+
+static void _pk_free_job(_pk_decode_job* job) {
+    if (job->bytes) pk_free(pk_get_allocator(), job->bytes);
+    pk_free(pk_get_allocator(), job);
+}
+
+static void _pk_run_job(_pk_decode_job* job) {
+    pk_alloc_tag tag = pk_set_alloc_tag(job->tag);
+    job->decode(job);
+    pk_set_alloc_tag(tag);
+}
+
+static void* _pk_decode_main(void* arg) {
+    (void)arg;
+    mt_mutex_lock(&_pk_decode.lock);
+    while (mt_atomic_load(&_pk_decode.running)) {
+        _pk_decode_job* job = _pk_job_pop(&_pk_decode.pending);
+        if (!job) {
+            mt_cond_wait(&_pk_decode.wake, &_pk_decode.lock);
+            continue;
+        }
+        mt_mutex_unlock(&_pk_decode.lock);
+        _pk_run_job(job);
+        mt_mutex_lock(&_pk_decode.lock);
+        _pk_job_push(&_pk_decode.done, job);
+    }
+    mt_mutex_unlock(&_pk_decode.lock);
+    return NULL;
+}
+
+static void _pk_decode_setup(int num_threads) {
+    memset(&_pk_decode, 0, sizeof(_pk_decode));
+    mt_mutex_init(&_pk_decode.lock);
+    mt_cond_init(&_pk_decode.wake);
+#ifndef PK_NO_DECODE_THREADS
+    //negative counts decode in the fetch callback, like a build without threads
+    _pk_decode.num_threads = num_threads < 0 ? 0 : (num_threads > PK_MAX_DECODE_THREADS ? PK_MAX_DECODE_THREADS : num_threads);
+    mt_atomic_store(&_pk_decode.running, 1);
+    for (int i = 0; i < _pk_decode.num_threads; ++i) {
+        if (mt_thread_create(&_pk_decode.threads[i], _pk_decode_main, NULL) != 0) {
+            pk_printf("Failed to start decode thread %d\n", i);
+            _pk_decode.num_threads = i;
+            break;
+        }
+    }
+#else
+    (void)num_threads;
+#endif
+}
+
+static void _pk_decode_shutdown(void) {
+    //under the lock, so no worker is between its check and the wait
+    mt_mutex_lock(&_pk_decode.lock);
+    mt_atomic_store(&_pk_decode.running, 0);
+    mt_cond_broadcast(&_pk_decode.wake);
+    mt_mutex_unlock(&_pk_decode.lock);
+    for (int i = 0; i < _pk_decode.num_threads; ++i) {
+        mt_thread_join(_pk_decode.threads[i]);
+    }
+    _pk_decode.num_threads = 0;
+    _pk_decode_job* job;
+    while ((job = _pk_job_pop(&_pk_decode.pending))) {
+        _pk_free_job(job);
+    }
+    while ((job = _pk_job_pop(&_pk_decode.done))) {
+        job->discard(job);
+        _pk_free_job(job);
+    }
+    mt_cond_destroy(&_pk_decode.wake);
+    mt_mutex_destroy(&_pk_decode.lock);
+}
+
+//called from a fetch callback, with the fetched data
+static void _pk_submit_job(const sfetch_response_t* response, pk_alloc_tag tag, _pk_job_fn decode, _pk_job_fn complete, _pk_job_fn discard) {
+    _pk_decode_job* job = (_pk_decode_job*)pk_alloc(pk_get_allocator(), sizeof(_pk_decode_job));
+    pk_assert(job);
+    memset(job, 0, sizeof(_pk_decode_job));
+    job->decode = decode;
+    job->complete = complete;
+    job->discard = discard;
+    job->tag = tag;
+
+    //zero terminated, for the text formats. Buffers from pk_manage_fetch_buffer
+    //are taken over, when the terminator fits, the ones of the request get copied.
+    if (response->data.ptr == response->buffer.ptr && response->data.size < response->buffer.size) {
+        job->bytes = _pk_take_fetch_buffer(response);
+    }
+    if (!job->bytes) {
+        job->bytes = pk_alloc(pk_get_allocator(), response->data.size + 1);
+        pk_assert(job->bytes);
+        memcpy(job->bytes, response->data.ptr, response->data.size);
+    }
+    ((uint8_t*)job->bytes)[response->data.size] = 0;
+
+    job->response = *response;
+    strncpy(job->path, response->path, SFETCH_MAX_PATH - 1);
+    memcpy(job->user_data, response->user_data, sizeof(job->user_data));
+    job->response.path = job->path;
+    job->response.user_data = job->user_data;
+    job->response.data = (sfetch_range_t){ job->bytes, response->data.size };
+    job->response.buffer = job->response.data;
+
+    if (_pk_decode.num_threads == 0) {
+        _pk_run_job(job);
+        _pk_job_push(&_pk_decode.done, job);
+        return;
+    }
+    mt_mutex_lock(&_pk_decode.lock);
+    _pk_job_push(&_pk_decode.pending, job);
+    mt_cond_signal(&_pk_decode.wake);
+    mt_mutex_unlock(&_pk_decode.lock);
+}
+
+void pk_dowork(void) {
+    sfetch_dowork();
+
+    mt_mutex_lock(&_pk_decode.lock);
+    _pk_job_list done = _pk_decode.done;
+    _pk_decode.done = (_pk_job_list){0};
+    mt_mutex_unlock(&_pk_decode.lock);
+
+    _pk_decode_job* job;
+    while ((job = _pk_job_pop(&done))) {
+        job->complete(job);
+        _pk_free_job(job);
+    }
+
+    //after the callbacks, so what they queued may go up this frame
+    _pk_process_uploads();
+}
+
+
+//--------------------------------------------------------------------------
+//--IMAGE-LOADING-----------------------------------------------------------
+//--------------------------------------------------------------------------
+
+typedef struct {
+    pk_image_loaded_callback loaded_cb;
+    pk_fail_callback fail_cb;
+    void* udata;
+} image_request_data;
+
+// from https://github.com/phoboslab/qoi/blob/master/qoiconv.c
+#define ENDS_WITH(str, end) (strcmp(str + strlen(str) - (sizeof(end)-1), end) == 0)
+
+static sg_pixel_format _pk_dds_to_sg_pixelformt(ddsktx_format fmt) {
+    switch(fmt) {
+        case DDSKTX_FORMAT_BC1:     return SG_PIXELFORMAT_BC1_RGBA; break;
+        case DDSKTX_FORMAT_BC2:     return SG_PIXELFORMAT_BC2_RGBA; break;
+        case DDSKTX_FORMAT_BC3:     return SG_PIXELFORMAT_BC3_RGBA; break;
+        case DDSKTX_FORMAT_BC4:     return SG_PIXELFORMAT_BC4_R; break;
+        case DDSKTX_FORMAT_BC5:     return SG_PIXELFORMAT_BC5_RG; break;
+        case DDSKTX_FORMAT_BC6H:    return SG_PIXELFORMAT_BC6H_RGBF; break;
+        case DDSKTX_FORMAT_BC7:     return SG_PIXELFORMAT_BC7_RGBA; break;
+        case DDSKTX_FORMAT_A8:
+        case DDSKTX_FORMAT_R8:      return SG_PIXELFORMAT_R8; break;
         case DDSKTX_FORMAT_RGBA8:
         case DDSKTX_FORMAT_RGBA8S:  return SG_PIXELFORMAT_RGBA8; break;
         case DDSKTX_FORMAT_RG16:    return SG_PIXELFORMAT_RG16; break;
@@ -1627,86 +3315,103 @@ static void _pk_try_image_fail(const sfetch_response_t* response, image_request_
     }
 }
 
-static void _pk_img_fetch_callback(const sfetch_response_t* response) {
-    image_request_data data = *(image_request_data*)response->user_data;
+//runs on a decode worker
+static bool _pk_decode_image(const sfetch_response_t* response, sg_image_desc* desc) {
+    if (ENDS_WITH(response->path, ".png")) {
+        cp_image_t result = cp_load_png_mem(response->buffer.ptr, (int)response->buffer.size);
+        if (!result.pix) {
+            return false;
+        }
+        void* pix = _pk_sized_detach(result.pix);
+        desc->data.mip_levels[0] = (sg_range){pix, result.w * result.h * 4};
+        desc->width = result.w;
+        desc->height = result.h;
+        desc->pixel_format = SG_PIXELFORMAT_RGBA8;
+        return true;
+    }
+    else if (ENDS_WITH(response->path, ".qoi")) {
+        qoi_desc qoi = { 0 };
+        void* pix = qoi_decode(response->buffer.ptr, (int)response->buffer.size, &qoi, 4);
+        if(!pix) {
+            return false;
+        }
+        desc->data.mip_levels[0] = (sg_range){pix, qoi.width * qoi.height * 4};
+        desc->width = qoi.width;
+        desc->height = qoi.height;
+        desc->pixel_format = SG_PIXELFORMAT_RGBA8;
+        return true;
+    } else if (ENDS_WITH(response->path, ".webp")) {
+        int width, height;
+        unsigned char* pix = twp_read_from_memory((void*)response->buffer.ptr, (int)response->buffer.size, &width, &height, twp_FORMAT_RGBA, 0);
+        if (!pix) {
+            return false;
+        }
+        desc->data.mip_levels[0] = (sg_range){pix, width * height * 4};
+        desc->width = width;
+        desc->height = height;
+        desc->pixel_format = SG_PIXELFORMAT_RGBA8;
+        return true;
+    } else if (ENDS_WITH(response->path, ".dds")) {
+        ddsktx_texture_info tc = {0};
+        if (ddsktx_parse(&tc, (const void*)response->buffer.ptr, (int)response->buffer.size, NULL)) {
+            desc->num_mipmaps = tc.num_mips;
+            desc->num_slices = tc.num_layers;
+            desc->pixel_format = _pk_dds_to_sg_pixelformt(tc.format);
+            desc->width = tc.width;
+            desc->height = tc.height;
+            desc->type = _pk_dds_to_sg_image_type(tc.flags);
+
+            for (int mip = 0; mip < tc.num_mips; mip++) {
+                ddsktx_sub_data sub_data;
+                ddsktx_get_sub(&tc, &sub_data, (const void*)response->buffer.ptr, (int)response->buffer.size, 0, 0, mip);
+                void* ptr = pk_alloc(pk_get_allocator(), sub_data.size_bytes);
+                pk_assert(ptr);
+                memcpy(ptr, sub_data.buff, sub_data.size_bytes);
+                desc->data.mip_levels[mip] = (sg_range){ptr, sub_data.size_bytes};
+            }
+            return true;
+        }
+        pk_printf("Failed to parse DDS image: %s\n", response->path);
+        return false;
+    }
+    pk_printf("Unsupported image format: %s\n", response->path);
+    return false;
+}
 
-    sg_image_desc desc = { 0 };
+static void _pk_img_decode_job(_pk_decode_job* job) {
+    job->ok = _pk_decode_image(&job->response, &job->result.image);
+}
+
+static void _pk_img_complete_job(_pk_decode_job* job) {
+    image_request_data data = *(image_request_data*)job->user_data;
+    if (job->ok) {
+        data.loaded_cb(&job->result.image, data.udata);
+    } else {
+        _pk_try_image_fail(&job->response, data);
+    }
+}
 
+static void _pk_img_discard_job(_pk_decode_job* job) {
+    if (job->ok) {
+        pk_release_image_desc(pk_get_allocator(), &job->result.image);
+    }
+}
+
+static void _pk_img_fetch_callback(const sfetch_response_t* response) {
     if (response->fetched) {
-        if (ENDS_WITH(response->path, ".png")) {
-            cp_image_t result = cp_load_png_mem(response->buffer.ptr, (int)response->buffer.size);
-            if (!result.pix) {
-                _pk_try_image_fail(response, data);
-                return;
-            }
-            desc.data.mip_levels[0] = (sg_range){result.pix, result.w * result.h * 4};
-            desc.width = result.w;
-            desc.height = result.h;
-            desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-            data.loaded_cb(&desc, data.udata);
-        }
-        else if (ENDS_WITH(response->path, ".qoi")) {
-            qoi_desc qoi = { 0 };
-            void* pix = qoi_decode(response->buffer.ptr, (int)response->buffer.size, &qoi, 4);
-            if(!pix) {
-                _pk_try_image_fail(response, data);
-                return;
-            }
-            desc.data.mip_levels[0] = (sg_range){pix, qoi.width * qoi.height * 4};
-            desc.width = qoi.width;
-            desc.height = qoi.height;
-            desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-            data.loaded_cb(&desc, data.udata);
-        } else if (ENDS_WITH(response->path, ".webp")) {
-            int width, height;
-            unsigned char* pix = twp_read_from_memory((void*)response->buffer.ptr, (int)response->buffer.size, &width, &height, twp_FORMAT_RGBA, 0);
-            if (!pix) {
-                _pk_try_image_fail(response, data);
-                return;
-            }
-            desc.data.mip_levels[0] = (sg_range){pix, width * height * 4};
-            desc.width = width;
-            desc.height = height;
-            desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-            data.loaded_cb(&desc, data.udata);
-        } else if (ENDS_WITH(response->path, ".dds")) {
-            ddsktx_texture_info tc = {0};
-            if (ddsktx_parse(&tc, (const void*)response->buffer.ptr, (int)response->buffer.size, NULL)) {
-                desc.num_mipmaps = tc.num_mips;
-                desc.num_slices = tc.num_layers;
-                desc.pixel_format = _pk_dds_to_sg_pixelformt(tc.format);
-                desc.width = tc.width;
-                desc.height = tc.height;
-                desc.type = _pk_dds_to_sg_image_type(tc.flags);
-
-                for (int mip = 0; mip < tc.num_mips; mip++) {
-                    ddsktx_sub_data sub_data;
-                    ddsktx_get_sub(&tc, &sub_data, (const void*)response->buffer.ptr, (int)response->buffer.size, 0, 0, mip);
-                    pk_allocator allocator = pk_default_allocator();
-                    void* ptr = pk_alloc(&allocator, sub_data.size_bytes);
-                    assert(ptr);
-                    memcpy(ptr, sub_data.buff, sub_data.size_bytes);
-                    desc.data.mip_levels[mip] = (sg_range){ptr, sub_data.size_bytes};
-                }
-                data.loaded_cb(&desc, data.udata);
-            } else {
-                pk_printf("Failed to parse DDS image: %s\n", response->path);
-                _pk_try_image_fail(response, data);
-            }
-        }
-        else {
-            pk_printf("Unsupported image format: %s\n", response->path);
-            _pk_try_image_fail(response, data);
-        }
+        _pk_submit_job(response, PK_ALLOC_TAG_IMAGE, _pk_img_decode_job, _pk_img_complete_job, _pk_img_discard_job);
     }
     else if (response->failed) {
         _pk_log_fetch_error(response);
-        _pk_try_image_fail(response, data);
+        _pk_try_image_fail(response, *(image_request_data*)response->user_data);
     }
+    pk_manage_fetch_buffer(response);
 }
 
 void pk_release_image_desc(pk_allocator* allocator, sg_image_desc *desc) {
-    for (int i = 0; i < desc->num_mipmaps; i++) {
+    //decoded images leave num_mipmaps at 0, which means one level
+    int num_mipmaps = PK_DEF(desc->num_mipmaps, 1);
+    for (int i = 0; i < num_mipmaps; i++) {
         if (desc->data.mip_levels[i].ptr) {
             pk_free(allocator, (void*)desc->data.mip_levels[i].ptr);
         }
@@ -1740,21 +3445,68 @@ typedef struct {
     void* udata;
 } m3d_request_data;
 
+//uncompressed models point into the fetched bytes, which are kept until the model is released
+typedef struct _pk_m3d_source {
+    struct _pk_m3d_source* next;
+    m3d_t* m3d;
+    void* bytes;
+} _pk_m3d_source;
+
+static _pk_m3d_source* _pk_m3d_sources;
+
 void pk_release_m3d_data(m3d_t* data) {
+    for (_pk_m3d_source** it = &_pk_m3d_sources; *it; it = &(*it)->next) {
+        if ((*it)->m3d == data) {
+            _pk_m3d_source* source = *it;
+            *it = source->next;
+            pk_free(pk_get_allocator(), source->bytes);
+            pk_free(pk_get_allocator(), source);
+            break;
+        }
+    }
     m3d_free(data);
 }
 
+static void _m3d_decode_job(_pk_decode_job* job) {
+    job->result.m3d = m3d_load((unsigned char*)job->bytes, NULL, NULL, NULL);
+}
+
+static void _m3d_complete_job(_pk_decode_job* job) {
+    m3d_request_data data = *(m3d_request_data*)job->user_data;
+    m3d_t* m3d = job->result.m3d;
+    if (!m3d) {
+        if (data.fail_cb != NULL) {
+            data.fail_cb(&job->response, data.udata);
+        }
+        return;
+    }
+    if (!(m3d->flags & M3D_FLG_FREERAW)) {
+        _pk_m3d_source* source = (_pk_m3d_source*)pk_alloc(pk_get_allocator(), sizeof(_pk_m3d_source));
+        pk_assert(source);
+        source->m3d = m3d;
+        source->bytes = job->bytes;
+        source->next = _pk_m3d_sources;
+        _pk_m3d_sources = source;
+        job->bytes = NULL;
+    }
+    if (data.loaded_cb != NULL) {
+        data.loaded_cb(m3d, data.udata);
+    } else {
+        pk_release_m3d_data(m3d);
+    }
+}
+
+static void _m3d_discard_job(_pk_decode_job* job) {
+    if (job->result.m3d) {
+        m3d_free(job->result.m3d);
+    }
+}
+
 static void _m3d_fetch_callback(const sfetch_response_t* response) {
     m3d_request_data data = *(m3d_request_data*)response->user_data;
 
     if (response->fetched) {
-        m3d_t* m3d = m3d_load((unsigned char*)response->buffer.ptr, NULL, NULL, NULL);
-        if (m3d != NULL && data.loaded_cb != NULL) {
-            data.loaded_cb(m3d, data.udata);
-        }
-        if (!m3d) {
-            data.fail_cb(response, data.udata);
-        }
+        _pk_submit_job(response, PK_ALLOC_TAG_MODEL, _m3d_decode_job, _m3d_complete_job, _m3d_discard_job);
     }
     else if (response->failed) {
         _pk_log_fetch_error(response);
@@ -1762,12 +3514,14 @@ static void _m3d_fetch_callback(const sfetch_response_t* response) {
             data.fail_cb(response, data.udata);
         }
     }
+    pk_manage_fetch_buffer(response);
 }
 
 sfetch_handle_t pk_load_m3d_data(const pk_m3d_request* req) {
     m3d_request_data data = {
         .loaded_cb = req->loaded_cb,
         .fail_cb = req->fail_cb,
+        .udata = req->udata,
     };
 
     return sfetch_send(&(sfetch_request_t) {
@@ -1790,35 +3544,53 @@ typedef struct {
     void* udata;
 } gltf_request_data;
 
-static void _gltf_fetch_callback(const sfetch_response_t* response) {
-    gltf_request_data data = *(gltf_request_data*)response->user_data;
-
-    if (response->fetched) {
-        cgltf_options options = {0};
-        cgltf_data* gltf = NULL;
-        cgltf_result result = cgltf_parse(
-            &options,
-            response->buffer.ptr,
-            response->buffer.size,
-            &gltf
-        );
+//also loads the external buffers, relative to the path
+static void _gltf_decode_job(_pk_decode_job* job) {
+    cgltf_options options = {0};
+    cgltf_data* gltf = NULL;
+    cgltf_result result = cgltf_parse(&options, job->bytes, job->response.data.size, &gltf);
+    if (result != cgltf_result_success) {
+        pk_printf("Failed to load glTF file: %s\n", job->path);
+        return;
+    }
+    //glb buffers point into the file data, so cgltf_free releases it from now on
+    gltf->file_data = job->bytes;
+    job->bytes = NULL;
+    result = cgltf_load_buffers(&options, gltf, job->path);
+    if (result != cgltf_result_success) {
+        pk_printf("Failed to load glTF buffers: %s\n", job->path);
+        cgltf_free(gltf);
+        return;
+    }
+    job->result.gltf = gltf;
+}
 
-        if (result != cgltf_result_success) {
-            pk_printf("Failed to load glTF file: %s", response->path);
-            return;
+static void _gltf_complete_job(_pk_decode_job* job) {
+    gltf_request_data data = *(gltf_request_data*)job->user_data;
+    if (job->result.gltf == NULL) {
+        if (data.fail_cb != NULL) {
+            data.fail_cb(&job->response, data.udata);
         }
+        return;
+    }
+    if (data.loaded_cb != NULL) {
+        data.loaded_cb(job->result.gltf, data.udata);
+    } else {
+        cgltf_free(job->result.gltf);
+    }
+}
 
-        result = cgltf_load_buffers(&options, gltf, response->path);
-        if (result != cgltf_result_success) {
-            pk_printf("Failed to load glTF buffers: %s", response->path);
-            cgltf_free(gltf);
-            return;
-        }
+static void _gltf_discard_job(_pk_decode_job* job) {
+    if (job->result.gltf) {
+        cgltf_free(job->result.gltf);
+    }
+}
 
-        if (gltf != NULL && data.loaded_cb != NULL) {
-            data.loaded_cb(gltf, data.udata);
-        }
+static void _gltf_fetch_callback(const sfetch_response_t* response) {
+    gltf_request_data data = *(gltf_request_data*)response->user_data;
 
+    if (response->fetched) {
+        _pk_submit_job(response, PK_ALLOC_TAG_MODEL, _gltf_decode_job, _gltf_complete_job, _gltf_discard_job);
     }
     else if (response->failed) {
         _pk_log_fetch_error(response);
@@ -1826,6 +3598,7 @@ static void _gltf_fetch_callback(const sfetch_response_t* response) {
             data.fail_cb(response, data.udata);
         }
     }
+    pk_manage_fetch_buffer(response);
 }
 
 sfetch_handle_t pk_load_gltf_data(const pk_gltf_request* req) {
@@ -1845,3 +3618,939 @@ sfetch_handle_t pk_load_gltf_data(const pk_gltf_request* req) {
 void pk_release_gltf_data(cgltf_data* data) {
     cgltf_free(data);
 }
+
+
+//-------------------------------------------------------------------------
+//--COOKED-MODELS----------------------------------------------------------
+//-------------------------------------------------------------------------
+
+
+#define PK_COOKED_MAGIC (0x4D4B5050u) //"PPKM"
+#define PK_COOKED_VERSION (2)
+#define PK_COOKED_ALIGN (16)
+#define PK_COOKED_PACKED (1u << 0)
+
+//all offsets count from the start of the file, each section starts PK_COOKED_ALIGN aligned
+typedef struct _pk_cooked_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t index_type; //sg_index_type of the whole index buffer
+    uint32_t node_count;
+    uint32_t mesh_count;
+    uint32_t primitive_count;
+    uint32_t channel_count;
+    uint64_t nodes_offset;
+    uint64_t meshes_offset;
+    uint64_t primitives_offset;
+    uint64_t channels_offset;
+    uint64_t vertices_offset;
+    uint64_t vertices_size;
+    uint64_t indices_offset;
+    uint64_t indices_size;
+    uint64_t keys_offset;
+    uint64_t keys_size;
+    uint64_t clips_offset;
+    uint32_t clip_count;
+    uint32_t reserved;
+} _pk_cooked_header;
+
+typedef struct _pk_cooked_node {
+    char name[PK_MAX_NAME_LEN];
+    int32_t parent; //-1 for roots, parents come before their children
+    float position[3];
+    float scale[3];
+    float rotation[4];
+} _pk_cooked_node;
+
+typedef struct _pk_cooked_mesh {
+    uint32_t node;
+    uint32_t first_primitive;
+    uint32_t primitive_count;
+} _pk_cooked_mesh;
+
+//the indices are already offset into the shared vertex buffer, so no base vertex is needed
+typedef struct _pk_cooked_primitive {
+    uint32_t base_element;
+    uint32_t num_elements;
+    float pos_scale[3];
+    float pos_offset[3];
+} _pk_cooked_primitive;
+
+typedef struct _pk_cooked_channel {
+    uint32_t node;
+    uint32_t path;
+    uint32_t interpolation;
+    uint32_t num_keyframes;
+    uint64_t times_offset;  //num_keyframes floats
+    uint64_t values_offset; //num_keyframes * 3 floats, 4 for rotations, three times that for cubic channels
+} _pk_cooked_channel;
+
+typedef struct _pk_cooked_clip {
+    char name[PK_MAX_NAME_LEN];
+    uint32_t first_channel;
+    uint32_t channel_count;
+    float duration;
+    uint32_t reserved;
+} _pk_cooked_clip;
+
+static uint64_t _pk_cooked_align(uint64_t offset) {
+    return (offset + PK_COOKED_ALIGN - 1) & ~(uint64_t)(PK_COOKED_ALIGN - 1);
+}
+
+static bool _pk_cook_channel_valid(const cgltf_animation_channel* channel) {
+    return channel->target_node && channel->sampler && channel->sampler->input && channel->sampler->output &&
+        (channel->target_path == cgltf_animation_path_type_translation ||
+         channel->target_path == cgltf_animation_path_type_rotation ||
+         channel->target_path == cgltf_animation_path_type_scale);
+}
+
+void* pk_cook_gltf(pk_allocator* allocator, cgltf_data* data, const pk_cook_desc* desc, size_t* size) {
+    pk_assert(allocator && data && desc && size);
+    pk_arena scratch;
+    pk_init_arena(allocator, &scratch, 0);
+    pk_allocator scratch_alloc = pk_arena_allocator(&scratch);
+    size_t* node_remap = sort_scene_nodes(&scratch_alloc, data);
+    pk_node* nodes = load_scene_nodes(&scratch_alloc, data, node_remap);
+
+    //count everything first, so the file is one allocation
+    uint32_t mesh_count = 0, primitive_count = 0, channel_count = 0;
+    size_t total_vertices = 0, total_indices = 0, max_vertices = 0, total_keys = 0;
+    for (size_t i = 0; i < data->nodes_count; ++i) {
+        const cgltf_mesh* gl_mesh = data->nodes[i].mesh;
+        if (!gl_mesh) continue;
+        mesh_count++;
+        for (size_t j = 0; j < gl_mesh->primitives_count; ++j) {
+            size_t vertex_count = interleave_attributes(&gl_mesh->primitives[j], NULL);
+            size_t index_count = load_indices(&gl_mesh->primitives[j], NULL);
+            if (vertex_count == 0 || index_count == 0) continue;
+            primitive_count++;
+            total_vertices += vertex_count;
+            total_indices += index_count;
+            if (vertex_count > max_vertices) max_vertices = vertex_count;
+        }
+    }
+    for (size_t i = 0; i < data->animations_count; ++i) {
+        for (size_t j = 0; j < data->animations[i].channels_count; ++j) {
+            const cgltf_animation_channel* channel = &data->animations[i].channels[j];
+            if (!_pk_cook_channel_valid(channel)) continue;
+            channel_count++;
+            //times, then the values
+            total_keys += channel->sampler->input->count * _pk_gltf_key_floats(channel);
+        }
+    }
+
+    const bool packed = desc->packed_vertices;
+    const sg_index_type index_type = _pk_index_type(total_vertices);
+    const size_t vertex_size = packed ? sizeof(pk_vertex_packed) : sizeof(pk_vertex_pnt);
+    const size_t index_size = index_type == SG_INDEXTYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    _pk_cooked_header header = { 0 };
+    header.magic = PK_COOKED_MAGIC;
+    header.version = PK_COOKED_VERSION;
+    header.flags = packed ? PK_COOKED_PACKED : 0;
+    header.index_type = (uint32_t)index_type;
+    header.node_count = (uint32_t)data->nodes_count;
+    header.mesh_count = mesh_count;
+    header.primitive_count = primitive_count;
+    header.channel_count = channel_count;
+    header.clip_count = (uint32_t)data->animations_count;
+    uint64_t offset = _pk_cooked_align(sizeof(_pk_cooked_header));
+    header.nodes_offset = offset;
+    offset = _pk_cooked_align(offset + header.node_count * sizeof(_pk_cooked_node));
+    header.meshes_offset = offset;
+    offset = _pk_cooked_align(offset + mesh_count * sizeof(_pk_cooked_mesh));
+    header.primitives_offset = offset;
+    offset = _pk_cooked_align(offset + primitive_count * sizeof(_pk_cooked_primitive));
+    header.channels_offset = offset;
+    offset = _pk_cooked_align(offset + channel_count * sizeof(_pk_cooked_channel));
+    header.clips_offset = offset;
+    offset = _pk_cooked_align(offset + header.clip_count * sizeof(_pk_cooked_clip));
+    header.vertices_offset = offset;
+    header.vertices_size = total_vertices * vertex_size;
+    offset = _pk_cooked_align(offset + header.vertices_size);
+    header.indices_offset = offset;
+    header.indices_size = total_indices * index_size;
+    offset = _pk_cooked_align(offset + header.indices_size);
+    header.keys_offset = offset;
+    header.keys_size = total_keys * sizeof(float);
+    offset += header.keys_size;
+
+    uint8_t* file = (uint8_t*)pk_alloc(allocator, (size_t)offset);
+    pk_assert(file);
+    memset(file, 0, (size_t)offset);
+
+    _pk_cooked_node* cooked_nodes = (_pk_cooked_node*)(file + header.nodes_offset);
+    for (uint32_t i = 0; i < header.node_count; ++i) {
+        const pk_node* node = &nodes[i];
+        _pk_cooked_node* cooked = &cooked_nodes[i];
+        memcpy(cooked->name, node->name, PK_MAX_NAME_LEN);
+        cooked->parent = node->parent ? (int32_t)(node->parent - nodes) : -1;
+        memcpy(cooked->position, node->position.Elements, sizeof(cooked->position));
+        memcpy(cooked->scale, node->scale.Elements, sizeof(cooked->scale));
+        memcpy(cooked->rotation, node->rotation.Elements, sizeof(cooked->rotation));
+    }
+
+    //same order as pk_load_gltf, so both loaders produce identical models
+    _pk_cooked_mesh* cooked_meshes = (_pk_cooked_mesh*)(file + header.meshes_offset);
+    _pk_cooked_primitive* cooked_prims = (_pk_cooked_primitive*)(file + header.primitives_offset);
+    uint8_t* vertex_dst = file + header.vertices_offset;
+    uint8_t* index_dst = file + header.indices_offset;
+    pk_vertex_pnt* vertices = pk_alloc(&scratch_alloc, PK_DEF(max_vertices, 1) * sizeof(pk_vertex_pnt));
+    uint32_t* indices = pk_alloc(&scratch_alloc, PK_DEF(total_indices, 1) * sizeof(uint32_t));
+    pk_assert(vertices && indices);
+    uint32_t mesh_idx = 0, prim_idx = 0;
+    size_t vertex_offset = 0, index_offset = 0;
+    for (size_t i = 0; i < data->nodes_count; ++i) {
+        const cgltf_mesh* gl_mesh = data->nodes[i].mesh;
+        if (!gl_mesh) continue;
+        _pk_cooked_mesh* mesh = &cooked_meshes[mesh_idx++];
+        mesh->node = (uint32_t)node_remap[i];
+        mesh->first_primitive = prim_idx;
+        for (size_t j = 0; j < gl_mesh->primitives_count; ++j) {
+            const cgltf_primitive* primitive = &gl_mesh->primitives[j];
+            size_t vertex_count = interleave_attributes(primitive, NULL);
+            size_t index_count = load_indices(primitive, NULL);
+            if (vertex_count == 0 || index_count == 0) continue;
+
+            interleave_attributes(primitive, vertices);
+            uint32_t* prim_indices = indices + index_offset;
+            load_indices(primitive, prim_indices);
+            stsvco_optimize(prim_indices, (unsigned int)index_count, (unsigned int)vertex_count, 32);
+            for (size_t k = 0; k < index_count; ++k) {
+                prim_indices[k] += (uint32_t)vertex_offset;
+            }
+
+            _pk_cooked_primitive* cooked = &cooked_prims[prim_idx++];
+            cooked->base_element = (uint32_t)index_offset;
+            cooked->num_elements = (uint32_t)index_count;
+            if (packed) {
+                pk_quant_params_t quant = pk_pack_vertices(vertices, (pk_vertex_packed*)vertex_dst + vertex_offset, vertex_count);
+                memcpy(cooked->pos_scale, quant.pos_scale.Elements, sizeof(cooked->pos_scale));
+                memcpy(cooked->pos_offset, quant.pos_offset.Elements, sizeof(cooked->pos_offset));
+            } else {
+                memcpy((pk_vertex_pnt*)vertex_dst + vertex_offset, vertices, vertex_count * sizeof(pk_vertex_pnt));
+            }
+            vertex_offset += vertex_count;
+            index_offset += index_count;
+        }
+        mesh->primitive_count = prim_idx - mesh->first_primitive;
+    }
+    sg_range index_range = _pk_index_range(indices, total_indices, index_type);
+    memcpy(index_dst, index_range.ptr, index_range.size);
+
+    _pk_cooked_channel* cooked_channels = (_pk_cooked_channel*)(file + header.channels_offset);
+    _pk_cooked_clip* cooked_clips = (_pk_cooked_clip*)(file + header.clips_offset);
+    float* keys = (float*)(file + header.keys_offset);
+    uint32_t channel_idx = 0;
+    for (size_t i = 0; i < data->animations_count; ++i) {
+        _pk_cooked_clip* clip = &cooked_clips[i];
+        if (data->animations[i].name) {
+            strncpy(clip->name, data->animations[i].name, PK_MAX_NAME_LEN - 1);
+        }
+        clip->first_channel = channel_idx;
+        for (size_t j = 0; j < data->animations[i].channels_count; ++j) {
+            const cgltf_animation_channel* gl_channel = &data->animations[i].channels[j];
+            if (!_pk_cook_channel_valid(gl_channel)) continue;
+            _pk_cooked_channel* channel = &cooked_channels[channel_idx++];
+            channel->node = (uint32_t)node_remap[cgltf_node_index(data, gl_channel->target_node)];
+            channel->path = gl_channel->target_path == cgltf_animation_path_type_translation ? PK_ANIM_PATH_TRANSLATION
+                : gl_channel->target_path == cgltf_animation_path_type_rotation ? PK_ANIM_PATH_ROTATION
+                : PK_ANIM_PATH_SCALE;
+            channel->interpolation = get_interpolation_type(gl_channel->sampler->interpolation);
+            channel->num_keyframes = (uint32_t)gl_channel->sampler->input->count;
+            const uint32_t components = _pk_anim_components((pk_gltf_anim_path_type)channel->path);
+            const uint32_t num_values = channel->num_keyframes * _pk_anim_value_stride(
+                (pk_gltf_anim_path_type)channel->path, (pk_gltf_anim_interp_type)channel->interpolation) / components;
+            channel->times_offset = (uint64_t)((uint8_t*)keys - file);
+            for (uint32_t k = 0; k < channel->num_keyframes; ++k) {
+                cgltf_accessor_read_float(gl_channel->sampler->input, k, &keys[k], 1);
+                if (keys[k] > clip->duration) clip->duration = keys[k];
+            }
+            keys += channel->num_keyframes;
+            channel->values_offset = (uint64_t)((uint8_t*)keys - file);
+            for (uint32_t k = 0; k < num_values; ++k) {
+                cgltf_accessor_read_float(gl_channel->sampler->output, k, &keys[k * components], components);
+            }
+            keys += num_values * components;
+        }
+        clip->channel_count = channel_idx - clip->first_channel;
+    }
+    memcpy(file, &header, sizeof(header));
+
+    pk_release_arena(&scratch);
+    *size = (size_t)offset;
+    return file;
+}
+
+static bool _pk_cooked_range_valid(uint64_t size, uint64_t offset, uint64_t bytes) {
+    return offset <= size && bytes <= size - offset;
+}
+
+//checks every count, index and range in the file, so loading never reads outside of it
+static bool _pk_cooked_model_valid(const uint8_t* file, size_t size) {
+    const _pk_cooked_header* header = (const _pk_cooked_header*)file;
+    if (size < sizeof(_pk_cooked_header) || header->magic != PK_COOKED_MAGIC) {
+        pk_printf("Not a cooked model\n");
+        return false;
+    }
+    if (header->version != PK_COOKED_VERSION) {
+        pk_printf("Cooked model has version %u, expected %u\n", header->version, PK_COOKED_VERSION);
+        return false;
+    }
+    if (!_pk_cooked_range_valid(size, header->nodes_offset, (uint64_t)header->node_count * sizeof(_pk_cooked_node)) ||
+        !_pk_cooked_range_valid(size, header->meshes_offset, (uint64_t)header->mesh_count * sizeof(_pk_cooked_mesh)) ||
+        !_pk_cooked_range_valid(size, header->primitives_offset, (uint64_t)header->primitive_count * sizeof(_pk_cooked_primitive)) ||
+        !_pk_cooked_range_valid(size, header->channels_offset, (uint64_t)header->channel_count * sizeof(_pk_cooked_channel)) ||
+        !_pk_cooked_range_valid(size, header->clips_offset, (uint64_t)header->clip_count * sizeof(_pk_cooked_clip)) ||
+        !_pk_cooked_range_valid(size, header->vertices_offset, header->vertices_size) ||
+        !_pk_cooked_range_valid(size, header->indices_offset, header->indices_size) ||
+        !_pk_cooked_range_valid(size, header->keys_offset, header->keys_size)) {
+        pk_printf("Cooked model is truncated\n");
+        return false;
+    }
+    if (header->node_count > UINT16_MAX || header->mesh_count > UINT16_MAX) {
+        pk_printf("Cooked model has too many nodes or meshes\n");
+        return false;
+    }
+    if (header->index_type != SG_INDEXTYPE_UINT16 && header->index_type != SG_INDEXTYPE_UINT32) {
+        pk_printf("Cooked model has an invalid index type %u\n", header->index_type);
+        return false;
+    }
+    const uint64_t num_indices = header->indices_size / (header->index_type == SG_INDEXTYPE_UINT16 ? 2 : 4);
+
+    const _pk_cooked_mesh* cooked_meshes = (const _pk_cooked_mesh*)(file + header->meshes_offset);
+    for (uint32_t i = 0; i < header->mesh_count; ++i) {
+        const _pk_cooked_mesh* mesh = &cooked_meshes[i];
+        if (mesh->node >= header->node_count || mesh->primitive_count > UINT16_MAX ||
+            !_pk_cooked_range_valid(header->primitive_count, mesh->first_primitive, mesh->primitive_count)) {
+            pk_printf("Cooked model has an invalid mesh %u\n", i);
+            return false;
+        }
+    }
+    const _pk_cooked_primitive* cooked_prims = (const _pk_cooked_primitive*)(file + header->primitives_offset);
+    for (uint32_t i = 0; i < header->primitive_count; ++i) {
+        const _pk_cooked_primitive* prim = &cooked_prims[i];
+        if (prim->num_elements > INT32_MAX || !_pk_cooked_range_valid(num_indices, prim->base_element, prim->num_elements)) {
+            pk_printf("Cooked model primitive %u is outside of the index buffer\n", i);
+            return false;
+        }
+    }
+    const _pk_cooked_clip* cooked_clips = (const _pk_cooked_clip*)(file + header->clips_offset);
+    for (uint32_t i = 0; i < header->clip_count; ++i) {
+        const _pk_cooked_clip* clip = &cooked_clips[i];
+        if (!_pk_cooked_range_valid(header->channel_count, clip->first_channel, clip->channel_count)) {
+            pk_printf("Cooked model clip %u has an invalid channel range\n", i);
+            return false;
+        }
+    }
+    const _pk_cooked_channel* cooked_channels = (const _pk_cooked_channel*)(file + header->channels_offset);
+    for (uint32_t i = 0; i < header->channel_count; ++i) {
+        const _pk_cooked_channel* channel = &cooked_channels[i];
+        if (channel->node >= header->node_count ||
+            channel->path < PK_ANIM_PATH_TRANSLATION || channel->path > PK_ANIM_PATH_SCALE ||
+            channel->interpolation < PK_ANIM_INTERP_LINEAR || channel->interpolation > PK_ANIM_INTERP_CUBIC ||
+            channel->num_keyframes > INT32_MAX) {
+            pk_printf("Cooked model has an invalid channel %u\n", i);
+            return false;
+        }
+        const uint64_t stride = (uint64_t)_pk_anim_value_stride(
+            (pk_gltf_anim_path_type)channel->path, (pk_gltf_anim_interp_type)channel->interpolation);
+        if (channel->times_offset < header->keys_offset || channel->values_offset < header->keys_offset ||
+            (channel->times_offset - header->keys_offset) % sizeof(float) != 0 ||
+            (channel->values_offset - header->keys_offset) % sizeof(float) != 0 ||
+            !_pk_cooked_range_valid(header->keys_size, channel->times_offset - header->keys_offset, (uint64_t)channel->num_keyframes * sizeof(float)) ||
+            !_pk_cooked_range_valid(header->keys_size, channel->values_offset - header->keys_offset, (uint64_t)channel->num_keyframes * stride * sizeof(float))) {
+            pk_printf("Cooked model channel %u is outside of the keys\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pk_load_cooked_model(pk_allocator* allocator, pk_model* model, pk_gltf_anim* anim, const void* data, size_t size) {
+    pk_assert(allocator && model && data);
+    const uint8_t* file = (const uint8_t*)data;
+    const _pk_cooked_header* header = (const _pk_cooked_header*)file;
+    if (!_pk_cooked_model_valid(file, size)) {
+        return false;
+    }
+    pk_alloc_tag tag = pk_set_alloc_tag(PK_ALLOC_TAG_MODEL);
+
+    const _pk_cooked_node* cooked_nodes = (const _pk_cooked_node*)(file + header->nodes_offset);
+    model->node_count = (uint16_t)header->node_count;
+    model->nodes = (pk_node*)pk_alloc(allocator, sizeof(pk_node) * PK_DEF(header->node_count, 1));
+    model->world_matrices = (HMM_Mat4*)pk_alloc(allocator, sizeof(HMM_Mat4) * PK_DEF(header->node_count, 1));
+    pk_assert(model->nodes && model->world_matrices);
+    for (uint32_t i = 0; i < header->node_count; ++i) {
+        const _pk_cooked_node* cooked = &cooked_nodes[i];
+        pk_node* node = &model->nodes[i];
+        memcpy(node->name, cooked->name, PK_MAX_NAME_LEN);
+        node->name[PK_MAX_NAME_LEN - 1] = '\0';
+        node->parent = cooked->parent >= 0 && (uint32_t)cooked->parent < i ? &model->nodes[cooked->parent] : NULL;
+        node->position = HMM_V3(cooked->position[0], cooked->position[1], cooked->position[2]);
+        node->scale = HMM_V3(cooked->scale[0], cooked->scale[1], cooked->scale[2]);
+        node->rotation = HMM_Q(cooked->rotation[0], cooked->rotation[1], cooked->rotation[2], cooked->rotation[3]);
+        node->dirty = true;
+    }
+
+    //the ranges point into the file, sokol copies them to the gpu
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc) {
+        .usage = { .vertex_buffer = true, .immutable = true },
+        .data = { file + header->vertices_offset, (size_t)header->vertices_size },
+    });
+    sg_buffer ibuf = sg_make_buffer(&(sg_buffer_desc) {
+        .usage = { .index_buffer = true, .immutable = true },
+        .data = { file + header->indices_offset, (size_t)header->indices_size },
+    });
+
+    const _pk_cooked_mesh* cooked_meshes = (const _pk_cooked_mesh*)(file + header->meshes_offset);
+    const _pk_cooked_primitive* cooked_prims = (const _pk_cooked_primitive*)(file + header->primitives_offset);
+    const bool packed = (header->flags & PK_COOKED_PACKED) != 0;
+    model->mesh_count = (uint16_t)header->mesh_count;
+    model->meshes = (pk_mesh*)pk_alloc(allocator, sizeof(pk_mesh) * PK_DEF(header->mesh_count, 1));
+    pk_assert(model->meshes);
+    for (uint32_t i = 0; i < header->mesh_count; ++i) {
+        const _pk_cooked_mesh* cooked = &cooked_meshes[i];
+        pk_mesh* mesh = &model->meshes[i];
+        mesh->node = &model->nodes[cooked->node];
+        mesh->primitive_count = (uint16_t)cooked->primitive_count;
+        mesh->primitives = (pk_primitive*)pk_alloc(allocator, sizeof(pk_primitive) * PK_DEF(cooked->primitive_count, 1));
+        pk_assert(mesh->primitives);
+        memset(mesh->primitives, 0, sizeof(pk_primitive) * PK_DEF(cooked->primitive_count, 1));
+        for (uint32_t j = 0; j < cooked->primitive_count; ++j) {
+            const _pk_cooked_primitive* cooked_prim = &cooked_prims[cooked->first_primitive + j];
+            pk_primitive* prim = &mesh->primitives[j];
+            prim->bindings.vertex_buffers[0] = vbuf;
+            prim->bindings.index_buffer = ibuf;
+            prim->base_element = (int)cooked_prim->base_element;
+            prim->num_elements = (int)cooked_prim->num_elements;
+            prim->index_type = (sg_index_type)header->index_type;
+            prim->packed = packed;
+            if (packed) {
+                prim->quant.pos_scale = HMM_V3(cooked_prim->pos_scale[0], cooked_prim->pos_scale[1], cooked_prim->pos_scale[2]);
+                prim->quant.pos_offset = HMM_V3(cooked_prim->pos_offset[0], cooked_prim->pos_offset[1], cooked_prim->pos_offset[2]);
+            }
+        }
+    }
+    model->index_type = (sg_index_type)header->index_type;
+    model->buffer_bytes = (size_t)(header->vertices_size + header->indices_size);
+    pk_update_model_transforms(model);
+    pk_set_alloc_tag(tag);
+
+    if (anim) {
+        tag = pk_set_alloc_tag(PK_ALLOC_TAG_ANIM);
+        memset(anim, 0, sizeof(pk_gltf_anim));
+        const _pk_cooked_channel* cooked_channels = (const _pk_cooked_channel*)(file + header->channels_offset);
+        const _pk_cooked_clip* cooked_clips = (const _pk_cooked_clip*)(file + header->clips_offset);
+        anim->num_clips = (int)header->clip_count;
+        anim->clips = (pk_gltf_anim_clip*)pk_alloc(allocator, sizeof(pk_gltf_anim_clip) * PK_DEF(header->clip_count, 1));
+        pk_assert(anim->clips);
+        for (uint32_t i = 0; i < header->clip_count; ++i) {
+            const _pk_cooked_clip* cooked = &cooked_clips[i];
+            memcpy(anim->clips[i].name, cooked->name, PK_MAX_NAME_LEN);
+            anim->clips[i].name[PK_MAX_NAME_LEN - 1] = '\0';
+            anim->clips[i].first_channel = (int)cooked->first_channel;
+            anim->clips[i].num_channels = (int)cooked->channel_count;
+            anim->clips[i].duration = cooked->duration;
+        }
+        anim->num_channels = (int)header->channel_count;
+        anim->channels = (pk_gltf_anim_channel*)pk_alloc(allocator, sizeof(pk_gltf_anim_channel) * PK_DEF(header->channel_count, 1));
+        pk_assert(anim->channels);
+        //the keys section already holds times and values per channel, so it is copied as one block
+        anim->keys = (float*)pk_alloc(allocator, PK_DEF(header->keys_size, sizeof(float)));
+        pk_assert(anim->keys);
+        memcpy(anim->keys, file + header->keys_offset, (size_t)header->keys_size);
+        for (uint32_t i = 0; i < header->channel_count; ++i) {
+            const _pk_cooked_channel* cooked = &cooked_channels[i];
+            pk_gltf_anim_channel* channel = &anim->channels[i];
+            channel->target_node = (int)cooked->node;
+            channel->path = (pk_gltf_anim_path_type)cooked->path;
+            channel->interpolation = (pk_gltf_anim_interp_type)cooked->interpolation;
+            channel->num_keyframes = (int)cooked->num_keyframes;
+            channel->times = anim->keys + (cooked->times_offset - header->keys_offset) / sizeof(float);
+            channel->values = anim->keys + (cooked->values_offset - header->keys_offset) / sizeof(float);
+        }
+        anim->ready = header->clip_count > 0;
+        pk_set_alloc_tag(tag);
+    }
+    return true;
+}
+
+bool pk_map_file(pk_mapped_file* file, const char* path) {
+    pk_assert(file && path);
+    memset(file, 0, sizeof(pk_mapped_file));
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+        CloseHandle(handle);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (!mapping) return false;
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) return false;
+    file->data = data;
+    file->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    //the mapping keeps the file open
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    file->data = data;
+    file->size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+void pk_unmap_file(pk_mapped_file* file) {
+    pk_assert(file);
+    if (!file->data) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(file->data);
+#else
+    munmap((void*)file->data, file->size);
+#endif
+    memset(file, 0, sizeof(pk_mapped_file));
+}
+
+bool pk_load_cooked_file(pk_allocator* allocator, pk_model* model, pk_gltf_anim* anim, const char* path) {
+    pk_mapped_file file;
+    if (!pk_map_file(&file, path)) {
+        pk_printf("Failed to map file: %s\n", path);
+        return false;
+    }
+    bool ok = pk_load_cooked_model(allocator, model, anim, file.data, file.size);
+    pk_unmap_file(&file);
+    return ok;
+}
+
+
+//-------------------------------------------------------------------------
+//--ASSET-CACHE------------------------------------------------------------
+//-------------------------------------------------------------------------
+
+
+//handles keep the slot index + 1 in the lower 16 bits, like sokol
+#define _PK_ASSET_SLOT_BITS (16)
+#define _PK_ASSET_SLOT_MASK ((1u << _PK_ASSET_SLOT_BITS) - 1)
+#define PK_MAX_ASSETS ((int)_PK_ASSET_SLOT_MASK - 1)
+
+typedef struct _pk_asset_entry {
+    uint32_t id; //0 while the slot is free
+    uint32_t gen;
+    pk_asset_type type;
+    pk_asset_state state;
+    int refs;
+    uint32_t hash;
+    char* path;
+    void* data;
+    size_t size;
+    bool unused; //linked into the lru list
+    struct _pk_asset_entry* lru_prev;
+    struct _pk_asset_entry* lru_next;
+    //the request, which started the load
+    sg_sampler_desc sampler;
+    pk_gltf_desc gltf;
+} _pk_asset_entry;
+
+static struct {
+    _pk_asset_entry* entries;
+    int capacity;
+    int* free_slots;
+    int free_count;
+    uint16_t* table; //open addressing by path hash, entry index + 1, 0 is empty
+    uint32_t table_mask;
+    _pk_asset_entry* lru_head; //least recently released
+    _pk_asset_entry* lru_tail;
+    size_t budget;
+    pk_asset_loader loaders[PK_ASSET_TYPE_COUNT];
+    pk_cache_stats stats;
+} _pk_cache;
+
+static uint32_t _pk_hash_path(const char* path) {
+    uint32_t h = 2166136261u;
+    for (const char* c = path; *c; ++c) h = (h ^ (uint8_t)*c) * 16777619u;
+    return h;
+}
+
+static _pk_asset_entry* _pk_lookup_asset(pk_asset asset) {
+    uint32_t slot = asset.id & _PK_ASSET_SLOT_MASK;
+    if (slot == 0 || (int)slot > _pk_cache.capacity) return NULL;
+    _pk_asset_entry* entry = &_pk_cache.entries[slot - 1];
+    return entry->id == asset.id ? entry : NULL;
+}
+
+static uint32_t _pk_find_table_pos(uint32_t hash, const char* path) {
+    uint32_t pos = hash & _pk_cache.table_mask;
+    while (_pk_cache.table[pos]) {
+        const _pk_asset_entry* entry = &_pk_cache.entries[_pk_cache.table[pos] - 1];
+        if (entry->hash == hash && strcmp(entry->path, path) == 0) break;
+        pos = (pos + 1) & _pk_cache.table_mask;
+    }
+    return pos;
+}
+
+//backward shift deletion, so later entries of the probe sequence stay reachable
+static void _pk_remove_table_pos(uint32_t pos) {
+    const uint32_t mask = _pk_cache.table_mask;
+    _pk_cache.table[pos] = 0;
+    uint32_t next = pos;
+    for (;;) {
+        next = (next + 1) & mask;
+        if (!_pk_cache.table[next]) break;
+        uint32_t home = _pk_cache.entries[_pk_cache.table[next] - 1].hash & mask;
+        //leave it, if its home lies cyclically in (pos, next]
+        bool stays = pos <= next ? (pos < home && home <= next) : (pos < home || home <= next);
+        if (!stays) {
+            _pk_cache.table[pos] = _pk_cache.table[next];
+            _pk_cache.table[next] = 0;
+            pos = next;
+        }
+    }
+}
+
+static void _pk_lru_push(_pk_asset_entry* entry) {
+    entry->lru_prev = _pk_cache.lru_tail;
+    entry->lru_next = NULL;
+    if (_pk_cache.lru_tail) _pk_cache.lru_tail->lru_next = entry;
+    else _pk_cache.lru_head = entry;
+    _pk_cache.lru_tail = entry;
+    entry->unused = true;
+    _pk_cache.stats.unused++;
+}
+
+static void _pk_lru_unlink(_pk_asset_entry* entry) {
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else _pk_cache.lru_head = entry->lru_next;
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else _pk_cache.lru_tail = entry->lru_prev;
+    entry->lru_prev = entry->lru_next = NULL;
+    entry->unused = false;
+    _pk_cache.stats.unused--;
+}
+
+static void _pk_drop_asset(_pk_asset_entry* entry) {
+    if (entry->unused) _pk_lru_unlink(entry);
+    _pk_remove_table_pos(_pk_find_table_pos(entry->hash, entry->path));
+    if (entry->state == PK_ASSET_STATE_READY) {
+        const pk_asset_loader* loader = &_pk_cache.loaders[entry->type];
+        if (loader->release) loader->release(entry->data);
+        _pk_cache.stats.ready--;
+        _pk_cache.stats.bytes -= entry->size;
+    } else if (entry->state == PK_ASSET_STATE_LOADING) {
+        _pk_cache.stats.loading--;
+    }
+    pk_free(pk_get_allocator(), entry->path);
+    const int slot = (int)(entry - _pk_cache.entries);
+    const uint32_t gen = entry->gen;
+    memset(entry, 0, sizeof(_pk_asset_entry));
+    entry->gen = gen;
+    _pk_cache.free_slots[_pk_cache.free_count++] = slot;
+}
+
+static void _pk_trim_asset_cache(void) {
+    while (_pk_cache.stats.bytes > _pk_cache.budget && _pk_cache.lru_head) {
+        _pk_drop_asset(_pk_cache.lru_head);
+        _pk_cache.stats.evictions++;
+    }
+}
+
+//an asset nobody holds, failed ones aren't kept
+static void _pk_unused_asset(_pk_asset_entry* entry) {
+    if (entry->state == PK_ASSET_STATE_FAILED) {
+        _pk_drop_asset(entry);
+    } else if (entry->state == PK_ASSET_STATE_READY) {
+        _pk_lru_push(entry);
+        _pk_trim_asset_cache();
+    }
+}
+
+pk_asset pk_acquire_asset(const pk_asset_request* req) {
+    pk_assert(req && req->path && req->type < PK_ASSET_TYPE_COUNT);
+    if (!_pk_cache.entries) return (pk_asset){ 0 };
+    const pk_asset_loader* loader = &_pk_cache.loaders[req->type];
+    if (!loader->load) {
+        pk_printf("No loader for asset: %s\n", req->path);
+        return (pk_asset){ 0 };
+    }
+
+    const uint32_t hash = _pk_hash_path(req->path);
+    uint32_t pos = _pk_find_table_pos(hash, req->path);
+    if (_pk_cache.table[pos]) {
+        _pk_asset_entry* entry = &_pk_cache.entries[_pk_cache.table[pos] - 1];
+        pk_assert(entry->type == req->type);
+        if (entry->unused) _pk_lru_unlink(entry);
+        entry->refs++;
+        _pk_cache.stats.hits++;
+        return (pk_asset){ entry->id };
+    }
+
+    _pk_cache.stats.misses++;
+    if (_pk_cache.free_count == 0 && _pk_cache.lru_head) {
+        _pk_drop_asset(_pk_cache.lru_head);
+        _pk_cache.stats.evictions++;
+        pos = _pk_find_table_pos(hash, req->path);
+    }
+    if (_pk_cache.free_count == 0) {
+        pk_printf("Asset cache full, can't load: %s\n", req->path);
+        return (pk_asset){ 0 };
+    }
+
+    const int slot = _pk_cache.free_slots[--_pk_cache.free_count];
+    _pk_asset_entry* entry = &_pk_cache.entries[slot];
+    entry->gen = (entry->gen + 1) & (UINT32_MAX >> _PK_ASSET_SLOT_BITS);
+    entry->id = (entry->gen << _PK_ASSET_SLOT_BITS) | (uint32_t)(slot + 1);
+    entry->type = req->type;
+    entry->state = PK_ASSET_STATE_LOADING;
+    entry->refs = 1;
+    entry->hash = hash;
+    const size_t len = strlen(req->path);
+    entry->path = (char*)pk_alloc(pk_get_allocator(), len + 1);
+    pk_assert(entry->path);
+    memcpy(entry->path, req->path, len + 1);
+    entry->sampler = req->sampler;
+    entry->gltf = req->gltf;
+    _pk_cache.table[pos] = (uint16_t)(slot + 1);
+    _pk_cache.stats.loading++;
+
+    pk_asset asset = { entry->id };
+    const void* params = req->params;
+    if (req->type == PK_ASSET_TEXTURE) params = &entry->sampler;
+    else if (req->type == PK_ASSET_MODEL) params = &entry->gltf;
+    loader->load(asset, entry->path, params);
+    return asset;
+}
+
+void pk_release_asset(pk_asset asset) {
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    if (!entry) return;
+    pk_assert(entry->refs > 0);
+    if (--entry->refs == 0) {
+        _pk_unused_asset(entry);
+    }
+}
+
+bool pk_resolve_asset(pk_asset asset, void* data, size_t size) {
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    if (!entry || entry->state != PK_ASSET_STATE_LOADING) return false;
+    _pk_cache.stats.loading--;
+    if (data) {
+        entry->state = PK_ASSET_STATE_READY;
+        entry->data = data;
+        entry->size = size;
+        _pk_cache.stats.ready++;
+        _pk_cache.stats.bytes += size;
+    } else {
+        entry->state = PK_ASSET_STATE_FAILED;
+    }
+    if (entry->refs == 0) {
+        _pk_unused_asset(entry);
+    } else {
+        _pk_trim_asset_cache();
+    }
+    return true;
+}
+
+pk_asset_state pk_query_asset_state(pk_asset asset) {
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    return entry ? entry->state : PK_ASSET_STATE_INVALID;
+}
+
+void* pk_asset_data(pk_asset asset) {
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    return entry && entry->state == PK_ASSET_STATE_READY ? entry->data : NULL;
+}
+
+const pk_texture* pk_asset_texture(pk_asset asset) {
+    pk_assert(!_pk_lookup_asset(asset) || _pk_lookup_asset(asset)->type == PK_ASSET_TEXTURE);
+    return (const pk_texture*)pk_asset_data(asset);
+}
+
+pk_model* pk_asset_model(pk_asset asset) {
+    pk_assert(!_pk_lookup_asset(asset) || _pk_lookup_asset(asset)->type == PK_ASSET_MODEL);
+    return (pk_model*)pk_asset_data(asset);
+}
+
+void pk_purge_asset_cache(void) {
+    while (_pk_cache.lru_head) {
+        _pk_drop_asset(_pk_cache.lru_head);
+        _pk_cache.stats.evictions++;
+    }
+}
+
+pk_cache_stats pk_get_cache_stats(void) {
+    return _pk_cache.stats;
+}
+
+void pk_set_asset_loader(pk_asset_type type, const pk_asset_loader* loader) {
+    pk_assert(type < PK_ASSET_TYPE_COUNT);
+    if (!_pk_cache.entries) return;
+    //the old loader has to release its assets, none of them may still be held
+    for (int i = 0; i < _pk_cache.capacity; ++i) {
+        _pk_asset_entry* entry = &_pk_cache.entries[i];
+        if (entry->id && entry->type == type) {
+            pk_assert(entry->refs == 0 && "release the assets of this type before replacing its loader");
+            _pk_drop_asset(entry);
+        }
+    }
+    _pk_cache.loaders[type] = loader ? *loader : (pk_asset_loader){ 0 };
+}
+
+//--BUILTIN-LOADERS------------
+
+static void _pk_texture_asset_loaded(sg_image_desc* desc, void* udata) {
+    pk_asset asset = { (uint32_t)(uintptr_t)udata };
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    if (!entry || entry->state != PK_ASSET_STATE_LOADING) {
+        pk_release_image_desc(pk_get_allocator(), desc);
+        return;
+    }
+    size_t size = 0;
+    for (int i = 0; i < PK_DEF(desc->num_mipmaps, 1); ++i) {
+        size += desc->data.mip_levels[i].size;
+    }
+    pk_texture* tex = (pk_texture*)pk_alloc(pk_get_allocator(), sizeof(pk_texture));
+    pk_assert(tex);
+    //the upload queue frees the pixels, the view follows the image
+    tex->image = sg_alloc_image();
+    tex->view = sg_alloc_view();
+    _pk_queue_image_view(tex->image, tex->view, desc, pk_get_allocator());
+    tex->sampler = sg_make_sampler(&entry->sampler);
+    pk_resolve_asset(asset, tex, size);
+}
+
+static void _pk_asset_fetch_failed(const sfetch_response_t* response, void* udata) {
+    (void)response;
+    pk_resolve_asset((pk_asset){ (uint32_t)(uintptr_t)udata }, NULL, 0);
+}
+
+static void _pk_load_texture_asset(pk_asset asset, const char* path, const void* params) {
+    (void)params;
+    pk_load_image_data(&(pk_image_request) {
+        .path = path,
+        .loaded_cb = _pk_texture_asset_loaded,
+        .fail_cb = _pk_asset_fetch_failed,
+        .udata = (void*)(uintptr_t)asset.id,
+    });
+}
+
+static void _pk_release_texture_asset(void* data) {
+    pk_release_texture((pk_texture*)data);
+    pk_free(pk_get_allocator(), data);
+}
+
+static void _pk_model_asset_loaded(cgltf_data* gltf, void* udata) {
+    pk_asset asset = { (uint32_t)(uintptr_t)udata };
+    _pk_asset_entry* entry = _pk_lookup_asset(asset);
+    if (!entry || entry->state != PK_ASSET_STATE_LOADING) {
+        pk_release_gltf_data(gltf);
+        return;
+    }
+    pk_model* model = (pk_model*)pk_alloc(pk_get_allocator(), sizeof(pk_model));
+    pk_assert(model);
+    memset(model, 0, sizeof(pk_model));
+    bool ok = pk_load_gltf(pk_get_allocator(), model, gltf, &entry->gltf);
+    pk_release_gltf_data(gltf);
+    if (!ok) {
+        pk_free(pk_get_allocator(), model);
+        model = NULL;
+    }
+    pk_resolve_asset(asset, model, model ? model->buffer_bytes : 0);
+}
+
+//cooked models need no decoding, they load straight from the fetch buffer
+static void _pk_cooked_asset_fetch_callback(const sfetch_response_t* response) {
+    pk_asset asset = *(pk_asset*)response->user_data;
+    if (response->fetched) {
+        _pk_asset_entry* entry = _pk_lookup_asset(asset);
+        if (entry && entry->state == PK_ASSET_STATE_LOADING) {
+            pk_model* model = (pk_model*)pk_alloc(pk_get_allocator(), sizeof(pk_model));
+            pk_assert(model);
+            memset(model, 0, sizeof(pk_model));
+            if (!pk_load_cooked_model(pk_get_allocator(), model, NULL, response->buffer.ptr, response->buffer.size)) {
+                pk_free(pk_get_allocator(), model);
+                model = NULL;
+            }
+            pk_resolve_asset(asset, model, model ? model->buffer_bytes : 0);
+        }
+    }
+    else if (response->failed) {
+        _pk_log_fetch_error(response);
+        pk_resolve_asset(asset, NULL, 0);
+    }
+    pk_manage_fetch_buffer(response);
+}
+
+static void _pk_load_model_asset(pk_asset asset, const char* path, const void* params) {
+    (void)params;
+    if (ENDS_WITH(path, ".pkm")) {
+        sfetch_send(&(sfetch_request_t) {
+            .path = path,
+            .callback = _pk_cooked_asset_fetch_callback,
+            .user_data = SFETCH_RANGE(asset),
+        });
+        return;
+    }
+    pk_load_gltf_data(&(pk_gltf_request) {
+        .path = path,
+        .loaded_cb = _pk_model_asset_loaded,
+        .fail_cb = _pk_asset_fetch_failed,
+        .udata = (void*)(uintptr_t)asset.id,
+    });
+}
+
+static void _pk_release_model_asset(void* data) {
+    pk_release_model(pk_get_allocator(), (pk_model*)data);
+    pk_free(pk_get_allocator(), data);
+}
+
+static void _pk_cache_setup(int capacity, size_t budget) {
+    memset(&_pk_cache, 0, sizeof(_pk_cache));
+    if (capacity > PK_MAX_ASSETS) capacity = PK_MAX_ASSETS;
+    //at most half full, so the probe sequences stay short
+    uint32_t table_size = 1;
+    while (table_size < 2 * (uint32_t)capacity) table_size <<= 1;
+
+    _pk_cache.capacity = capacity;
+    _pk_cache.budget = budget;
+    _pk_cache.table_mask = table_size - 1;
+    _pk_cache.entries = (_pk_asset_entry*)pk_alloc(pk_get_allocator(), capacity * sizeof(_pk_asset_entry));
+    _pk_cache.free_slots = (int*)pk_alloc(pk_get_allocator(), capacity * sizeof(int));
+    _pk_cache.table = (uint16_t*)pk_alloc(pk_get_allocator(), table_size * sizeof(uint16_t));
+    pk_assert(_pk_cache.entries && _pk_cache.free_slots && _pk_cache.table);
+    memset(_pk_cache.entries, 0, capacity * sizeof(_pk_asset_entry));
+    memset(_pk_cache.table, 0, table_size * sizeof(uint16_t));
+    //lowest slots first
+    for (int i = 0; i < capacity; ++i) {
+        _pk_cache.free_slots[i] = capacity - 1 - i;
+    }
+    _pk_cache.free_count = capacity;
+
+    _pk_cache.loaders[PK_ASSET_TEXTURE] = (pk_asset_loader){ _pk_load_texture_asset, _pk_release_texture_asset };
+    _pk_cache.loaders[PK_ASSET_MODEL] = (pk_asset_loader){ _pk_load_model_asset, _pk_release_model_asset };
+}
+
+static void _pk_cache_shutdown(void) {
+    if (!_pk_cache.entries) return;
+    for (int i = 0; i < _pk_cache.capacity; ++i) {
+        if (_pk_cache.entries[i].id) {
+            _pk_drop_asset(&_pk_cache.entries[i]);
+        }
+    }
+    pk_free(pk_get_allocator(), _pk_cache.entries);
+    pk_free(pk_get_allocator(), _pk_cache.free_slots);
+    pk_free(pk_get_allocator(), _pk_cache.table);
+    memset(&_pk_cache, 0, sizeof(_pk_cache));
+}
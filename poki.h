@@ -46,8 +46,6 @@ typedef struct sapp_event sapp_event;
 
 //--ALLOCATOR--------------------------------------------
 
-//TODO: Hook to dependencies.
-
 typedef void* (*pk_alloc_fn)(size_t size, void* udata);
 typedef void  (*pk_free_fn)(void* ptr, void* udata);
 
@@ -62,6 +60,92 @@ void pk_free(pk_allocator* alloc, void* ptr);
 
 //returns an allocator which just uses malloc and free.
 pk_allocator pk_default_allocator(void);
+//the allocator from pk_desc, the dependencies (sokol, cgltf, m3d, image decoders) allocate through it.
+//Image data from pk_load_image_data comes from it too, release it with this allocator.
+pk_allocator* pk_get_allocator(void);
+
+/*
+Linear allocator, carving allocations out of blocks taken from a backing allocator.
+pk_free is a no-op on it; memory is reclaimed with pk_rewind_arena or pk_reset_arena,
+and the blocks are kept for reuse until pk_release_arena.
+*/
+typedef struct pk_arena_block pk_arena_block;
+
+typedef struct pk_arena {
+    pk_allocator backing;
+    size_t block_size;
+    pk_arena_block* first;
+    pk_arena_block* current;
+} pk_arena;
+
+typedef struct pk_arena_mark {
+    pk_arena_block* block;
+    size_t offset;
+} pk_arena_mark;
+
+//block_size default: 64KB, bigger allocations get a block of their own.
+void pk_init_arena(pk_allocator* allocator, pk_arena* arena, size_t block_size);
+void pk_release_arena(pk_arena* arena);
+void* pk_arena_alloc(pk_arena* arena, size_t size);
+pk_arena_mark pk_arena_get_mark(const pk_arena* arena);
+void pk_rewind_arena(pk_arena* arena, pk_arena_mark mark);
+void pk_reset_arena(pk_arena* arena);
+pk_allocator pk_arena_allocator(pk_arena* arena);
+
+//scratch memory that stays valid until the next pk_reset_frame_allocator, call that once per frame.
+pk_allocator pk_frame_allocator(void);
+pk_arena* pk_frame_arena(void);
+void pk_reset_frame_allocator(void);
+
+/*
+Tracking allocator, wraps another allocator and keeps statistics per tag.
+Each allocation gets the tag of the pk_tracking_allocator it came through. Allocations
+through the PK_ALLOC_TAG_OTHER allocator get the tag of the loader that made them,
+so handing it to pk_desc splits the dependencies' memory up as well.
+The tracker is thread safe, the audio decoder thread may allocate through it.
+*/
+typedef enum pk_alloc_tag {
+    PK_ALLOC_TAG_OTHER,
+    PK_ALLOC_TAG_MODEL,
+    PK_ALLOC_TAG_ANIM,
+    PK_ALLOC_TAG_IMAGE,
+    PK_ALLOC_TAG_AUDIO,
+    PK_ALLOC_TAG_COUNT,
+} pk_alloc_tag;
+
+typedef struct pk_alloc_stats {
+    size_t live_bytes;
+    size_t peak_bytes;
+    size_t live_count;
+    size_t total_count; //allocations made so far
+} pk_alloc_stats;
+
+typedef struct pk_alloc_tracker pk_alloc_tracker;
+
+typedef struct pk_alloc_tracker_view {
+    pk_alloc_tracker* tracker;
+    pk_alloc_tag tag;
+} pk_alloc_tracker_view;
+
+struct pk_alloc_tracker {
+    pk_allocator backing;
+    pk_alloc_stats stats[PK_ALLOC_TAG_COUNT];
+    pk_alloc_stats total;
+    pk_alloc_tracker_view views[PK_ALLOC_TAG_COUNT];
+    void* lock;
+    void* live; //live allocations, for the leak report
+};
+
+void pk_init_alloc_tracker(pk_allocator* backing, pk_alloc_tracker* tracker);
+void pk_release_alloc_tracker(pk_alloc_tracker* tracker);
+pk_allocator pk_tracking_allocator(pk_alloc_tracker* tracker, pk_alloc_tag tag);
+//PK_ALLOC_TAG_COUNT returns the totals
+pk_alloc_stats pk_get_alloc_stats(pk_alloc_tracker* tracker, pk_alloc_tag tag);
+//prints the allocations which are still live, returns their count
+size_t pk_report_alloc_leaks(pk_alloc_tracker* tracker);
+const char* pk_alloc_tag_name(pk_alloc_tag tag);
+//sets the tag for allocations made through the PK_ALLOC_TAG_OTHER allocator, returns the previous one
+pk_alloc_tag pk_set_alloc_tag(pk_alloc_tag tag);
 
 
 //--INIT&SHUTDOWN----------------------------------------
@@ -69,10 +153,40 @@ pk_allocator pk_default_allocator(void);
 typedef struct pk_desc {
     sg_desc gfx;
     sfetch_desc_t fetch;
+    pk_allocator allocator; //default: pk_default_allocator(), also used by sokol if gfx/fetch have none
+    size_t frame_arena_size; //default: 1MB, grows if needed
+    bool report_leaks; //prints what is still live at pk_shutdown, allocator must be a pk_tracking_allocator
+    int decode_threads; //default: 2, negative decodes on the thread calling pk_dowork. The allocator must be thread safe.
+    size_t upload_budget; //bytes of queued uploads pk_dowork hands to the gpu per frame, default: 8MB
+    size_t fetch_buffer_size; //default: 16MB, for load requests without a buffer
+    int asset_capacity; //default: 256, assets the cache can hold at once
+    size_t asset_budget; //default: 256MB, unused assets get evicted above this
 } pk_desc;
 
 void pk_setup(const pk_desc* desc);
 void pk_shutdown(void);
+//call once per frame instead of sfetch_dowork, the loaded callbacks of the pk_load_*_data functions run in here
+void pk_dowork(void);
+
+
+//--UPLOAD-QUEUE------------------------------------------
+//Queued resources get initialized by pk_dowork, spread over frames to stay within pk_desc.upload_budget.
+//Until then they are in SG_RESOURCESTATE_ALLOC and draws using them are skipped.
+
+typedef struct pk_upload_stats {
+    int queued;
+    size_t queued_bytes;
+    size_t frame_bytes; //uploaded by the last pk_dowork
+    size_t total_bytes;
+} pk_upload_stats;
+
+//The data must stay valid until the upload, then it is freed with owner.
+//Without an owner the data gets copied, so it can be freed right away.
+void pk_queue_image_init(sg_image image, const sg_image_desc* desc, pk_allocator* owner);
+void pk_queue_buffer_init(sg_buffer buffer, const sg_buffer_desc* desc, pk_allocator* owner);
+sg_image pk_queue_image_upload(const sg_image_desc* desc, pk_allocator* owner);
+sg_buffer pk_queue_buffer_upload(const sg_buffer_desc* desc, pk_allocator* owner);
+pk_upload_stats pk_get_upload_stats(void);
 
 
 //--CAMERA------------------------------------------------------------
@@ -131,6 +245,7 @@ sg_image_desc pk_gen_mipmaps_cpu(pk_allocator* allocator, const sg_image_desc* s
 typedef struct pk_texture {
     sg_image image;
     sg_sampler sampler;
+    sg_view view; //optional, shared by the primitives the texture is bound to
 } pk_texture;
 
 #ifdef __cplusplus
@@ -175,10 +290,15 @@ typedef struct pk_node {
     HMM_Vec3 position;
     HMM_Vec3 scale;
     HMM_Quat rotation;
+    //Set this after changing position, scale or rotation of a model node,
+    //so pk_update_model_transforms picks up the change.
+    bool dirty;
 } pk_node;
 
 void pk_init_node(pk_node* node);
+//Walks up the whole parent chain. For model nodes prefer the cached pk_model.world_matrices.
 HMM_Mat4 pk_node_transform(const pk_node* node);
+HMM_Mat4 pk_node_local_transform(const pk_node* node);
 
 
 //--PRIMITIVE--------------------------------------------------------------
@@ -191,6 +311,17 @@ typedef struct pk_vertex_pnt {
 
 sg_vertex_layout_state pk_pnt_layout(void);
 
+//16 byte alternative to pk_vertex_pnt, drawn with the *_packed shader programs.
+typedef struct pk_vertex_packed {
+    int16_t pos[4]; //normalized to the bounds of the primitive, w is padding
+    int16_t nrm[2]; //octahedral encoded
+    uint16_t uv[2]; //half floats
+} pk_vertex_packed;
+
+sg_vertex_layout_state pk_packed_layout(void);
+//Packs count vertices into dst and returns the params, which scale the positions back.
+pk_quant_params_t pk_pack_vertices(const pk_vertex_pnt* src, pk_vertex_packed* dst, size_t count);
+
 typedef struct pk_vertex_skin {
     uint8_t indices[4];
     float weights[4];
@@ -198,25 +329,67 @@ typedef struct pk_vertex_skin {
 
 sg_vertex_layout_state pk_skinned_layout(void);
 
+//Per instance data, read by the *_inst shader programs.
+typedef struct pk_instance {
+    HMM_Mat4 model; //applied on top of vs_params.model
+    sg_color color; //multiplied with the fragment color
+} pk_instance;
+
+//Vertex buffer slot the instance data gets bound to.
+#define PK_INSTANCE_BUFFER_SLOT 1
+
+//pk_vertex_pnt in buffer 0 and pk_instance in buffer 1, stepped per instance.
+sg_vertex_layout_state pk_pnt_instanced_layout(void);
+
 typedef struct {
 	sg_range vertices;
 	sg_range indices;
 	int num_elements;
+    sg_index_type index_type; //default: SG_INDEXTYPE_UINT32, if there are indices
     bool is_mutable;
+    bool queue_upload; //copies the data into the upload queue, see pk_primitive_ready
 } pk_primitive_desc;
 
 typedef struct pk_primitive {
 	sg_bindings bindings;
 	int base_element;
 	int num_elements;
+	int base_vertex; //added to each index, when the primitive lives in a shared buffer
+	sg_index_type index_type; //the pipeline drawing this primitive needs the same index type
+	bool packed; //pk_vertex_packed vertices, quant gets applied before each draw
+	pk_quant_params_t quant;
+	uint32_t shared_views; //bit per view slot, which pk_release_primitive leaves alone, because a pk_texture owns it
 } pk_primitive;
 
+typedef struct pk_m3d_desc {
+    bool packed_vertices; //pk_vertex_packed instead of pk_vertex_pnt in buffer 0
+    bool queue_uploads; //the buffers go through the upload queue
+} pk_m3d_desc;
+
 void pk_alloc_primitive(pk_primitive* primitive, uint16_t vubf_count, uint16_t view_count);
 void pk_init_primitive(pk_primitive* primitive, const pk_primitive_desc* desc);
-bool pk_load_m3d(pk_allocator* allocator, pk_primitive* mesh, pk_node* node, m3d_t* m3d);
+bool pk_load_m3d(pk_allocator* allocator, pk_primitive* mesh, pk_node* node, m3d_t* m3d, const pk_m3d_desc* desc);
 void pk_release_primitive(pk_primitive* primitive);
 void pk_texture_primitive(pk_primitive* primitive, const pk_texture* tex, int slot);
 void pk_draw_primitive(const pk_primitive* primitive, int num_instances);
+//false while one of its buffers waits in the upload queue
+bool pk_primitive_ready(const pk_primitive* primitive);
+
+//--INSTANCING-------------------------------------------------------------
+
+typedef struct pk_instance_buffer {
+    sg_buffer buffer;
+    int capacity;
+    int count;
+} pk_instance_buffer;
+
+void pk_init_instance_buffer(pk_instance_buffer* buf, int capacity);
+//Streams the instances to the gpu. Like sg_update_buffer, only call this once per frame.
+void pk_update_instance_buffer(pk_instance_buffer* buf, const pk_instance* instances, int count);
+void pk_release_instance_buffer(pk_instance_buffer* buf);
+//Draws all instances of the buffer in one call. Needs a pipeline with pk_pnt_instanced_layout,
+//so packed primitives can't be drawn instanced.
+void pk_draw_primitive_instanced(const pk_primitive* primitive, const pk_instance_buffer* buf);
 
 //--MESH------------------------------------------------------------------
 
@@ -227,6 +400,7 @@ typedef struct pk_mesh {
 } pk_mesh;
 
 void pk_draw_mesh(pk_mesh* mesh, pk_vs_params_t* vs_params);
+void pk_draw_mesh_instanced(pk_mesh* mesh, pk_vs_params_t* vs_params, const pk_instance_buffer* buf);
 void pk_release_mesh(pk_mesh* mesh);
 
 
@@ -234,16 +408,86 @@ void pk_release_mesh(pk_mesh* mesh);
 
 typedef struct pk_model {
     pk_mesh* meshes;
-    pk_node* nodes;
+    pk_node* nodes; //sorted, so parents always come before their children
+    HMM_Mat4* world_matrices; //one per node, see pk_update_model_transforms
     uint16_t mesh_count;
     uint16_t node_count;
+    sg_index_type index_type; //shared by all primitives, so one pipeline can draw the whole model
+    size_t buffer_bytes; //vertex and index data
 } pk_model;
 
-bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data);
+typedef struct pk_gltf_desc {
+    //Packs all primitives of the model into one vertex and one index buffer,
+    //so the whole model draws with a single binding.
+    bool merge_buffers;
+    //Loads pk_vertex_packed instead of pk_vertex_pnt vertices.
+    bool packed_vertices;
+    //The buffers go through the upload queue instead of being created right away.
+    bool queue_uploads;
+} pk_gltf_desc;
+
+bool pk_load_gltf(pk_allocator* allocator, pk_model* model, cgltf_data* data, const pk_gltf_desc* desc);
 void pk_release_model(pk_allocator* allocator, pk_model* model);
+//true once all primitives are uploaded
+bool pk_model_ready(const pk_model* model);
 pk_node* pk_find_model_node(const pk_model*, const char* name);
 void pk_set_model_texture(pk_model* model, const pk_texture* tex, int slot);
+//Recomputes the world matrices of all dirty nodes and their children in a single pass.
+//Called by pk_draw_model, so you only need it, if you read world_matrices yourself.
+void pk_update_model_transforms(pk_model* model);
 void pk_draw_model(pk_model* model, pk_vs_params_t* vs_params);
+void pk_draw_model_instanced(pk_model* model, pk_vs_params_t* vs_params, const pk_instance_buffer* buf);
+
+
+//--RENDER-QUEUE----------------------------------------------------------
+//Collects the draws of a frame, sorts them by pipeline, texture and buffers
+//and skips all sg_apply_* calls, which would not change any state.
+//Items get sorted, so don't use it for transparent geometry.
+
+typedef void(*pk_pipeline_applied_callback)(sg_pipeline pip, void* udata);
+
+typedef struct pk_render_queue_desc {
+    int capacity; //max draw items per flush, default 1024
+    //Called after every pipeline switch. Since sg_apply_pipeline invalidates all uniforms,
+    //apply your fragment shader uniforms (material, light...) here.
+    pk_pipeline_applied_callback pipeline_cb;
+    void* udata;
+} pk_render_queue_desc;
+
+typedef struct pk_draw_item {
+    uint64_t key;
+    sg_pipeline pipeline;
+    const pk_primitive* primitive; //has to stay valid until the queue is flushed
+    HMM_Mat4 model;
+} pk_draw_item;
+
+typedef struct pk_render_stats {
+    int draws;
+    int pipeline_applies;
+    int pipeline_skips;
+    int bindings_applies;
+    int bindings_skips;
+    int uniforms_applies;
+    int uniforms_skips;
+} pk_render_stats;
+
+typedef struct pk_render_queue {
+    pk_draw_item* items;
+    int count;
+    int capacity;
+    pk_pipeline_applied_callback pipeline_cb;
+    void* udata;
+    pk_render_stats stats; //of the last flush
+} pk_render_queue;
+
+void pk_init_render_queue(pk_allocator* allocator, pk_render_queue* queue, const pk_render_queue_desc* desc);
+void pk_release_render_queue(pk_allocator* allocator, pk_render_queue* queue);
+void pk_queue_primitive(pk_render_queue* queue, sg_pipeline pip, const pk_primitive* primitive, const HMM_Mat4* model);
+void pk_queue_mesh(pk_render_queue* queue, sg_pipeline pip, const pk_mesh* mesh);
+void pk_queue_model(pk_render_queue* queue, sg_pipeline pip, pk_model* model);
+//Sorts and draws all queued items, then clears the queue.
+//vs_params.model gets filled in per item, like in pk_draw_model.
+void pk_flush_render_queue(pk_render_queue* queue, pk_vs_params_t* vs_params);
 
 
 //--ANIMATION-------------------------------------------------------------
@@ -261,34 +505,85 @@ typedef enum {
     PK_ANIM_INTERP_UNDEFINED,
     PK_ANIM_INTERP_LINEAR,
     PK_ANIM_INTERP_STEP,
-    PK_ANIM_INTERP_CUBIC, //not used - atm we force cubic to linear
+    PK_ANIM_INTERP_CUBIC, //hermite spline with the tangents of the gltf sampler
 } pk_gltf_anim_interp_type;
 
-typedef struct pk_gltf_keyframe {
-    float time;
-    float* value;
-} pk_gltf_keyframe;
-
 typedef struct pk_gltf_anim_channel {
-    pk_node* target_node;
-    pk_gltf_keyframe* keyframes;
+    int target_node; //index into pk_model.nodes
+    float* times;  //num_keyframes times, inside pk_gltf_anim.keys
+    float* values; //num_keyframes values of 3 floats, 4 for rotations, inside pk_gltf_anim.keys.
+                   //cubic keys store in-tangent, value and out-tangent back to back
     int num_keyframes;
     pk_gltf_anim_path_type path;
     pk_gltf_anim_interp_type interpolation;
 } pk_gltf_anim_channel;
 
-typedef struct pk_gltf_anim {
-    pk_gltf_anim_channel* channels;
+typedef struct pk_gltf_anim_clip {
+    char name[PK_MAX_NAME_LEN];
+    int first_channel;
     int num_channels;
     float duration;
-    float elapsed_time;
-    bool loop;
+} pk_gltf_anim_clip;
+
+//All clips of a gltf file. It is only read during playback, so any number of
+//model instances can play it, each with its own pk_gltf_anim_state.
+typedef struct pk_gltf_anim {
+    pk_gltf_anim_clip* clips;
+    pk_gltf_anim_channel* channels; //grouped by clip
+    float* keys; //times and values of all channels, one allocation
+    int num_clips;
+    int num_channels;
     bool ready;
 } pk_gltf_anim;
 
+//Playback of one clip on one model instance, see pk_init_gltf_anim_state.
+typedef struct pk_gltf_anim_state {
+    int clip; //index into pk_gltf_anim.clips, see pk_find_gltf_anim_clip
+    float time;
+    bool loop;
+    //keyframe pair of the last sample per channel, so the next search starts there.
+    //Sized for the largest clip, so clip can change between calls.
+    int* cursors;
+    int num_cursors;
+} pk_gltf_anim_state;
+
 bool pk_load_gltf_anim(pk_allocator* allocator, pk_gltf_anim* anim, pk_model* model, cgltf_data* data);
 void pk_release_gltf_anim(pk_allocator* allocator, pk_gltf_anim* anim);
-void pk_play_gltf_anim(pk_gltf_anim* anim, float delta_time);
+//Allocates a cursor per channel of the largest clip of anim and starts at clip 0.
+void pk_init_gltf_anim_state(pk_allocator* allocator, pk_gltf_anim_state* state, const pk_gltf_anim* anim);
+void pk_release_gltf_anim_state(pk_allocator* allocator, pk_gltf_anim_state* state);
+//-1 if there is no clip with that name
+int pk_find_gltf_anim_clip(const pk_gltf_anim* anim, const char* name);
+//Advances the state and writes the clip into the nodes of model, which has to have
+//the node layout of the model the animation was loaded for.
+void pk_play_gltf_anim(const pk_gltf_anim* anim, pk_gltf_anim_state* state, pk_model* model, float delta_time);
+
+//Local transforms of all nodes of a model, indexed like pk_model.nodes. Clips sample into poses,
+//which can be blended and then applied to a model, so many instances sample in tight loops
+//without touching their nodes.
+typedef struct pk_gltf_pose {
+    HMM_Quat* rotations;
+    HMM_Vec3* translations;
+    HMM_Vec3* scales;
+    //the node transforms at pk_init_gltf_pose, which pk_reset_gltf_pose goes back to
+    HMM_Quat* rest_rotations;
+    HMM_Vec3* rest_translations;
+    HMM_Vec3* rest_scales;
+    int num_nodes;
+} pk_gltf_pose;
+
+//Allocates the arrays as one block and fills them and the rest pose from the nodes of model,
+//so call it before anything animates the model.
+void pk_init_gltf_pose(pk_allocator* allocator, pk_gltf_pose* pose, const pk_model* model);
+void pk_release_gltf_pose(pk_allocator* allocator, pk_gltf_pose* pose);
+//Goes back to the rest pose, for nodes the sampled clip does not animate.
+void pk_reset_gltf_pose(pk_gltf_pose* pose);
+//Like pk_play_gltf_anim, but writes into pose. Nodes without a channel in the clip keep their values.
+void pk_sample_gltf_anim(const pk_gltf_anim* anim, pk_gltf_anim_state* state, pk_gltf_pose* pose, float delta_time);
+//pose_a = lerp(pose_a, pose_b, weight)
+void pk_blend_gltf_poses(pk_gltf_pose* pose_a, const pk_gltf_pose* pose_b, float weight);
+//Writes the pose into the nodes of model and marks them dirty.
+void pk_apply_gltf_pose(pk_model* model, const pk_gltf_pose* pose);
 
 //--M3D------------------------------
 
@@ -341,9 +636,14 @@ void pk_release_bone_anims(pk_allocator* allocator, pk_bone_anim_set* set);
 //--IO---------------------------------------------------------------------------
 
 //Maybe add optional automatic texture loading for models.
+//Fetched files are decoded on worker threads, the callbacks get called from pk_dowork.
 
 typedef void(*pk_fail_callback)(const sfetch_response_t* response, void* udata);
 
+//Requests without a buffer get one of pk_desc.fetch_buffer_size, while they are in flight.
+//The pk_load_* functions do this already, custom fetch callbacks call it last.
+void pk_manage_fetch_buffer(const sfetch_response_t* response);
+
 //--IMAGE-LOADING----------
 
 void pk_release_image_desc(pk_allocator* allocator, sg_image_desc* desc);
@@ -393,6 +693,101 @@ sfetch_handle_t pk_load_gltf_data(const pk_gltf_request* req);
 void pk_release_gltf_data(cgltf_data* data);
 
 
+//--COOKED-MODELS-------------
+/*
+Binary models with the vertex and index data already laid out like the gpu wants it,
+one shared vertex and index buffer plus the node table and animation tracks.
+Cook them once with pk_cook_gltf or the pkcook tool, loading then does no per vertex work.
+*/
+
+typedef struct pk_cook_desc {
+    bool packed_vertices; //pk_vertex_packed instead of pk_vertex_pnt
+} pk_cook_desc;
+
+//Returns the whole file, allocated with allocator.
+void* pk_cook_gltf(pk_allocator* allocator, cgltf_data* data, const pk_cook_desc* desc, size_t* size);
+//anim is optional. data only has to stay valid during the call.
+bool pk_load_cooked_model(pk_allocator* allocator, pk_model* model, pk_gltf_anim* anim, const void* data, size_t size);
+//Maps the file and loads straight from the mapping.
+bool pk_load_cooked_file(pk_allocator* allocator, pk_model* model, pk_gltf_anim* anim, const char* path);
+
+typedef struct pk_mapped_file {
+    const void* data;
+    size_t size;
+} pk_mapped_file;
+
+bool pk_map_file(pk_mapped_file* file, const char* path);
+void pk_unmap_file(pk_mapped_file* file);
+
+//--ASSET-CACHE---------------------------------------------------------------
+/*
+Assets are keyed by path. Acquiring a path which is loaded or still loading returns the same asset,
+only the first request fetches it. Released assets stay resident, until they are acquired again
+or the cache needs the memory, the least recently released go first.
+Poll pk_query_asset_state, like sg_query_image_state.
+*/
+
+typedef struct pk_asset { uint32_t id; } pk_asset;
+
+typedef enum pk_asset_type {
+    PK_ASSET_TEXTURE, //pk_asset_texture
+    PK_ASSET_MODEL,   //gltf or cooked .pkm, both fetched, pk_asset_model
+    PK_ASSET_SOUND,   //loader registered by pk_audio_setup
+    PK_ASSET_TYPE_COUNT,
+} pk_asset_type;
+
+typedef enum pk_asset_state {
+    PK_ASSET_STATE_INVALID,
+    PK_ASSET_STATE_LOADING,
+    PK_ASSET_STATE_READY,
+    PK_ASSET_STATE_FAILED,
+} pk_asset_state;
+
+typedef struct pk_asset_request {
+    const char* path;
+    pk_asset_type type;
+    //only used by the request, which starts the load
+    sg_sampler_desc sampler; //textures
+    pk_gltf_desc gltf;       //models
+    const void* params;      //passed to the loader of other types
+} pk_asset_request;
+
+typedef struct pk_asset_loader {
+    //starts loading, then calls pk_resolve_asset from pk_dowork
+    void (*load)(pk_asset asset, const char* path, const void* params);
+    //frees the data passed to pk_resolve_asset
+    void (*release)(void* data);
+} pk_asset_loader;
+
+typedef struct pk_cache_stats {
+    int ready;
+    int loading;
+    int unused; //ready, but not acquired, these get evicted first
+    size_t bytes;
+    int hits;
+    int misses;
+    int evictions;
+} pk_cache_stats;
+
+//Every acquire needs a pk_release_asset. Returns an invalid asset, if the cache is full.
+pk_asset pk_acquire_asset(const pk_asset_request* req);
+void pk_release_asset(pk_asset asset);
+pk_asset_state pk_query_asset_state(pk_asset asset);
+//NULL until the asset is ready
+void* pk_asset_data(pk_asset asset);
+const pk_texture* pk_asset_texture(pk_asset asset);
+pk_model* pk_asset_model(pk_asset asset);
+//Evicts all unused assets.
+void pk_purge_asset_cache(void);
+pk_cache_stats pk_get_cache_stats(void);
+
+//Replacing or removing (NULL) a loader drops all assets of its type, unused or still loading.
+//Held assets of the type have to be released first.
+void pk_set_asset_loader(pk_asset_type type, const pk_asset_loader* loader);
+//data is NULL if loading failed. Returns false if the asset was dropped meanwhile, then the caller frees the data.
+bool pk_resolve_asset(pk_asset asset, void* data, size_t size);
+
+
 #ifdef __cplusplus
 } //extern "C"
 #endif
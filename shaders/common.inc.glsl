@@ -8,6 +8,25 @@ layout(binding=0) uniform vs_params {
 };
 @end
 
+//Dequantization of the 16 bit normalized positions of pk_vertex_packed.
+@block quant_uniforms
+layout(binding=4) uniform quant_params {
+    vec3 pos_scale;
+    vec3 pos_offset;
+};
+@end
+
+//Octahedral normal, see _pk_oct_encode in poki.c.
+@block oct_decode
+vec3 oct_decode(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x -= (n.x >= 0.0 ? 1.0 : -1.0) * t;
+    n.y -= (n.y >= 0.0 ? 1.0 : -1.0) * t;
+    return normalize(n);
+}
+@end
+
 @block dirlight_uniforms
 layout(binding=3) uniform dir_light {
     vec3 direction;
@@ -226,3 +226,227 @@ void main() {
 
 @program phong_tex phong_tex_vs phong_tex_fs
 @program skinned_phong_tex skinned_vs phong_tex_fs
+
+
+//--INSTANCED-----------------------------------------------------------------
+//Per instance model matrix and color from a second vertex buffer, see pk_pnt_instanced_layout().
+//The instance matrix is applied on top of vs_params.model.
+
+@block instance_attrs
+layout(location=3) in vec4 inst_m0;
+layout(location=4) in vec4 inst_m1;
+layout(location=5) in vec4 inst_m2;
+layout(location=6) in vec4 inst_m3;
+layout(location=7) in vec4 inst_color;
+@end
+
+//UNLIT
+
+@vs unlit_inst_vs
+layout(location=0) in vec3 position;
+layout(location=1) in vec3 normal;
+layout(location=2) in vec2 uv;
+@include_block instance_attrs
+
+layout(location=0) out vec2 v_uv;
+layout(location=1) out vec4 v_color;
+
+@include_block vs_uniforms
+
+void main() {
+    mat4 inst = mat4(inst_m0, inst_m1, inst_m2, inst_m3);
+    gl_Position = proj * view * (inst * model) * vec4(position, 1.0);
+    v_uv = uv;
+    v_color = inst_color;
+}
+@end
+
+@fs unlit_col_inst_fs
+
+layout(binding=1) uniform color {
+    vec4 col;
+};
+
+//v_uv is unused, but keeps the inputs in line with unlit_inst_vs
+layout(location=0) in vec2 v_uv;
+layout(location=1) in vec4 v_color;
+
+out vec4 frag_color;
+
+void main() {
+    frag_color = col * v_color;
+}
+@end
+
+@fs unlit_tex_inst_fs
+
+layout(binding=0) uniform sampler smp;
+layout(binding=0)uniform texture2D tex;
+
+layout(location=0) in vec2 v_uv;
+layout(location=1) in vec4 v_color;
+
+out vec4 frag_color;
+
+void main() {
+    vec4 col = texture(sampler2D(tex, smp), v_uv);
+    frag_color = col * v_color;
+}
+@end
+
+@program unlit_color_inst unlit_inst_vs unlit_col_inst_fs
+@program unlit_tex_inst unlit_inst_vs unlit_tex_inst_fs
+
+//PHONG
+
+@vs phong_inst_vs
+layout(location=0) in vec3 position;
+layout(location=1) in vec3 normal;
+layout(location=2) in vec2 uv;
+@include_block instance_attrs
+
+layout(location=0) out vec3 v_pos;
+layout(location=1) out vec3 v_normal;
+layout(location=2) out vec2 v_uv;
+layout(location=3) out vec3 v_viewpos;
+layout(location=4) out vec4 v_color;
+
+@include_block vs_uniforms
+
+void main() {
+    mat4 world = mat4(inst_m0, inst_m1, inst_m2, inst_m3) * model;
+    gl_Position = proj * view * world * vec4(position, 1.0);
+    v_pos = vec3(world * vec4(position, 1.0));
+    v_normal = mat3(world) * normal;
+    v_uv = uv;
+    v_viewpos = viewpos;
+    v_color = inst_color;
+}
+@end
+
+@fs phong_color_inst_fs
+layout(location=0) in vec3 v_pos;
+layout(location=1) in vec3 v_normal;
+layout(location=2) in vec2 v_uv; //unused, keeps the inputs in line with phong_inst_vs
+layout(location=3) in vec3 v_viewpos;
+layout(location=4) in vec4 v_color;
+
+out vec4 FragColor;
+
+layout(binding=2) uniform col_material {
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 specular;
+    float shininess;
+} col_mat;
+
+@include_block dirlight_uniforms
+@include_block phong
+
+void main() {
+    vec3 result = phong_light(
+        v_pos,
+        v_normal,
+        v_viewpos,
+        col_mat.ambient.rgb,
+        col_mat.diffuse.rgb,
+        col_mat.specular.rgb,
+        col_mat.shininess,
+        vec4(1.0)
+    );
+    FragColor = vec4(result, 1.0) * v_color;
+}
+@end
+
+@fs phong_tex_inst_fs
+layout(location=0) in vec3 v_pos;
+layout(location=1) in vec3 v_normal;
+layout(location=2) in vec2 v_uv;
+layout(location=3) in vec3 v_viewpos;
+layout(location=4) in vec4 v_color;
+
+out vec4 FragColor;
+
+layout(binding=0) uniform sampler col_smp;
+layout(binding=0) uniform texture2D col_tex;
+
+layout(binding=2) uniform tex_material {
+    float shininess;
+} tex_mat;
+
+@include_block dirlight_uniforms
+@include_block phong
+
+void main() {
+    vec4 tex = texture(sampler2D(col_tex, col_smp), v_uv);
+    vec3 result = phong_light(
+        v_pos,
+        v_normal,
+        v_viewpos,
+        tex.rgb,
+        tex.rgb,
+        vec3(tex.a),
+        tex_mat.shininess,
+        tex
+    );
+    FragColor = vec4(result, 1.0) * v_color;
+}
+@end
+
+@program phong_color_inst phong_inst_vs phong_color_inst_fs
+@program phong_tex_inst phong_inst_vs phong_tex_inst_fs
+
+
+//--PACKED--------------------------------------------------------------------
+//Vertices in the 16 byte pk_vertex_packed format, see pk_packed_layout().
+//Positions get scaled back by the quant_params of the primitive,
+//normals are octahedral encoded and uvs are half floats.
+
+//UNLIT
+
+@vs unlit_packed_vs
+layout(location=0) in vec4 position;
+layout(location=1) in vec2 normal;
+layout(location=2) in vec2 uv;
+
+out vec2 v_uv;
+
+@include_block vs_uniforms
+@include_block quant_uniforms
+
+void main() {
+    vec3 pos = position.xyz * pos_scale + pos_offset;
+    gl_Position = proj * view * model * vec4(pos, 1.0);
+    v_uv = uv;
+}
+@end
+
+@program unlit_tex_packed unlit_packed_vs unlit_tex_fs
+
+//PHONG
+
+@vs phong_packed_vs
+layout(location=0) in vec4 position;
+layout(location=1) in vec2 normal;
+layout(location=2) in vec2 uv;
+
+out vec3 v_pos;
+out vec3 v_normal;
+out vec2 v_uv;
+out vec3 v_viewpos;
+
+@include_block vs_uniforms
+@include_block quant_uniforms
+@include_block oct_decode
+
+void main() {
+    vec4 pos = vec4(position.xyz * pos_scale + pos_offset, 1.0);
+    gl_Position = proj * view * model * pos;
+    v_pos = vec3(model * pos);
+    v_normal = mat3(model) * oct_decode(normal);
+    v_uv = uv;
+    v_viewpos = viewpos;
+}
+@end
+
+@program phong_tex_packed phong_packed_vs phong_tex_fs
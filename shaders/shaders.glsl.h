@@ -17,6 +17,19 @@
             ATTR_pk_phong_color_position => 0
             ATTR_pk_phong_color_normal => 1
             ATTR_pk_phong_color_uv => 2
+    Shader program: 'phong_color_inst':
+        Get shader desc: pk_phong_color_inst_shader_desc(sg_query_backend());
+        Vertex Shader: phong_inst_vs
+        Fragment Shader: phong_color_inst_fs
+        Attributes:
+            ATTR_pk_phong_color_inst_position => 0
+            ATTR_pk_phong_color_inst_normal => 1
+            ATTR_pk_phong_color_inst_uv => 2
+            ATTR_pk_phong_color_inst_inst_m0 => 3
+            ATTR_pk_phong_color_inst_inst_m1 => 4
+            ATTR_pk_phong_color_inst_inst_m2 => 5
+            ATTR_pk_phong_color_inst_inst_m3 => 6
+            ATTR_pk_phong_color_inst_inst_color => 7
     Shader program: 'phong_tex':
         Get shader desc: pk_phong_tex_shader_desc(sg_query_backend());
         Vertex Shader: phong_tex_vs
@@ -25,6 +38,27 @@
             ATTR_pk_phong_tex_position => 0
             ATTR_pk_phong_tex_normal => 1
             ATTR_pk_phong_tex_uv => 2
+    Shader program: 'phong_tex_inst':
+        Get shader desc: pk_phong_tex_inst_shader_desc(sg_query_backend());
+        Vertex Shader: phong_inst_vs
+        Fragment Shader: phong_tex_inst_fs
+        Attributes:
+            ATTR_pk_phong_tex_inst_position => 0
+            ATTR_pk_phong_tex_inst_normal => 1
+            ATTR_pk_phong_tex_inst_uv => 2
+            ATTR_pk_phong_tex_inst_inst_m0 => 3
+            ATTR_pk_phong_tex_inst_inst_m1 => 4
+            ATTR_pk_phong_tex_inst_inst_m2 => 5
+            ATTR_pk_phong_tex_inst_inst_m3 => 6
+            ATTR_pk_phong_tex_inst_inst_color => 7
+    Shader program: 'phong_tex_packed':
+        Get shader desc: pk_phong_tex_packed_shader_desc(sg_query_backend());
+        Vertex Shader: phong_packed_vs
+        Fragment Shader: phong_tex_fs
+        Attributes:
+            ATTR_pk_phong_tex_packed_position => 0
+            ATTR_pk_phong_tex_packed_normal => 1
+            ATTR_pk_phong_tex_packed_uv => 2
     Shader program: 'skinned_phong_tex':
         Get shader desc: pk_skinned_phong_tex_shader_desc(sg_query_backend());
         Vertex Shader: skinned_vs
@@ -41,6 +75,19 @@
         Fragment Shader: unlit_col_fs
         Attributes:
             ATTR_pk_unlit_color_position => 0
+    Shader program: 'unlit_color_inst':
+        Get shader desc: pk_unlit_color_inst_shader_desc(sg_query_backend());
+        Vertex Shader: unlit_inst_vs
+        Fragment Shader: unlit_col_inst_fs
+        Attributes:
+            ATTR_pk_unlit_color_inst_position => 0
+            ATTR_pk_unlit_color_inst_normal => 1
+            ATTR_pk_unlit_color_inst_uv => 2
+            ATTR_pk_unlit_color_inst_inst_m0 => 3
+            ATTR_pk_unlit_color_inst_inst_m1 => 4
+            ATTR_pk_unlit_color_inst_inst_m2 => 5
+            ATTR_pk_unlit_color_inst_inst_m3 => 6
+            ATTR_pk_unlit_color_inst_inst_color => 7
     Shader program: 'unlit_tex':
         Get shader desc: pk_unlit_tex_shader_desc(sg_query_backend());
         Vertex Shader: unlit_tex_vs
@@ -49,6 +96,27 @@
             ATTR_pk_unlit_tex_position => 0
             ATTR_pk_unlit_tex_normal => 1
             ATTR_pk_unlit_tex_uv => 2
+    Shader program: 'unlit_tex_inst':
+        Get shader desc: pk_unlit_tex_inst_shader_desc(sg_query_backend());
+        Vertex Shader: unlit_inst_vs
+        Fragment Shader: unlit_tex_inst_fs
+        Attributes:
+            ATTR_pk_unlit_tex_inst_position => 0
+            ATTR_pk_unlit_tex_inst_normal => 1
+            ATTR_pk_unlit_tex_inst_uv => 2
+            ATTR_pk_unlit_tex_inst_inst_m0 => 3
+            ATTR_pk_unlit_tex_inst_inst_m1 => 4
+            ATTR_pk_unlit_tex_inst_inst_m2 => 5
+            ATTR_pk_unlit_tex_inst_inst_m3 => 6
+            ATTR_pk_unlit_tex_inst_inst_color => 7
+    Shader program: 'unlit_tex_packed':
+        Get shader desc: pk_unlit_tex_packed_shader_desc(sg_query_backend());
+        Vertex Shader: unlit_packed_vs
+        Fragment Shader: unlit_tex_fs
+        Attributes:
+            ATTR_pk_unlit_tex_packed_position => 0
+            ATTR_pk_unlit_tex_packed_normal => 1
+            ATTR_pk_unlit_tex_packed_uv => 2
     Bindings:
         Uniform block 'vs_params':
             C struct: pk_vs_params_t
@@ -98,24 +166,63 @@
 #define ATTR_pk_phong_color_position (0)
 #define ATTR_pk_phong_color_normal (1)
 #define ATTR_pk_phong_color_uv (2)
+#define ATTR_pk_phong_color_inst_position (0)
+#define ATTR_pk_phong_color_inst_normal (1)
+#define ATTR_pk_phong_color_inst_uv (2)
+#define ATTR_pk_phong_color_inst_inst_m0 (3)
+#define ATTR_pk_phong_color_inst_inst_m1 (4)
+#define ATTR_pk_phong_color_inst_inst_m2 (5)
+#define ATTR_pk_phong_color_inst_inst_m3 (6)
+#define ATTR_pk_phong_color_inst_inst_color (7)
 #define ATTR_pk_phong_tex_position (0)
 #define ATTR_pk_phong_tex_normal (1)
 #define ATTR_pk_phong_tex_uv (2)
+#define ATTR_pk_phong_tex_inst_position (0)
+#define ATTR_pk_phong_tex_inst_normal (1)
+#define ATTR_pk_phong_tex_inst_uv (2)
+#define ATTR_pk_phong_tex_inst_inst_m0 (3)
+#define ATTR_pk_phong_tex_inst_inst_m1 (4)
+#define ATTR_pk_phong_tex_inst_inst_m2 (5)
+#define ATTR_pk_phong_tex_inst_inst_m3 (6)
+#define ATTR_pk_phong_tex_inst_inst_color (7)
+#define ATTR_pk_phong_tex_packed_position (0)
+#define ATTR_pk_phong_tex_packed_normal (1)
+#define ATTR_pk_phong_tex_packed_uv (2)
 #define ATTR_pk_skinned_phong_tex_pos (0)
 #define ATTR_pk_skinned_phong_tex_nrm (1)
 #define ATTR_pk_skinned_phong_tex_uv (2)
 #define ATTR_pk_skinned_phong_tex_bone_indices (3)
 #define ATTR_pk_skinned_phong_tex_weights (4)
 #define ATTR_pk_unlit_color_position (0)
+#define ATTR_pk_unlit_color_inst_position (0)
+#define ATTR_pk_unlit_color_inst_normal (1)
+#define ATTR_pk_unlit_color_inst_uv (2)
+#define ATTR_pk_unlit_color_inst_inst_m0 (3)
+#define ATTR_pk_unlit_color_inst_inst_m1 (4)
+#define ATTR_pk_unlit_color_inst_inst_m2 (5)
+#define ATTR_pk_unlit_color_inst_inst_m3 (6)
+#define ATTR_pk_unlit_color_inst_inst_color (7)
 #define ATTR_pk_unlit_tex_position (0)
 #define ATTR_pk_unlit_tex_normal (1)
 #define ATTR_pk_unlit_tex_uv (2)
+#define ATTR_pk_unlit_tex_inst_position (0)
+#define ATTR_pk_unlit_tex_inst_normal (1)
+#define ATTR_pk_unlit_tex_inst_uv (2)
+#define ATTR_pk_unlit_tex_inst_inst_m0 (3)
+#define ATTR_pk_unlit_tex_inst_inst_m1 (4)
+#define ATTR_pk_unlit_tex_inst_inst_m2 (5)
+#define ATTR_pk_unlit_tex_inst_inst_m3 (6)
+#define ATTR_pk_unlit_tex_inst_inst_color (7)
+#define ATTR_pk_unlit_tex_packed_position (0)
+#define ATTR_pk_unlit_tex_packed_normal (1)
+#define ATTR_pk_unlit_tex_packed_uv (2)
 #define UB_pk_vs_params (0)
 #define UB_pk_dir_light (3)
 #define UB_pk_col_material (2)
 #define UB_pk_tex_material (2)
 #define UB_pk_bone_matrices (1)
 #define UB_pk_color (1)
+#define UB_pk_quant_params (4)
 #define VIEW_pk_col_tex (0)
 #define VIEW_pk_tex (0)
 #define SMP_pk_col_smp (0)
@@ -163,6 +270,14 @@ SOKOL_SHDC_ALIGN(16) typedef struct pk_color_t {
     sg_color col;
 } pk_color_t;
 #pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct pk_quant_params_t {
+    HMM_Vec3 pos_scale;
+    uint8_t _pad_12[4];
+    HMM_Vec3 pos_offset;
+    uint8_t _pad_28[4];
+} pk_quant_params_t;
+#pragma pack(pop)
 /*
     #version 430
 
@@ -807,271 +922,901 @@ static const uint8_t pk_phong_tex_fs_source_glsl430[1249] = {
     0x00,
 };
 /*
-    cbuffer bone_matrices : register(b1)
-    {
-        row_major float4x4 _28_bones[32] : packoffset(c0);
-    };
+    #version 430
 
-    cbuffer vs_params : register(b0)
+    uniform vec4 vs_params[13];
+    layout(location = 3) in vec4 inst_m0;
+    layout(location = 4) in vec4 inst_m1;
+    layout(location = 5) in vec4 inst_m2;
+    layout(location = 6) in vec4 inst_m3;
+    layout(location = 0) in vec3 position;
+    layout(location = 0) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 1) out vec4 v_color;
+    layout(location = 7) in vec4 inst_color;
+    layout(location = 1) in vec3 normal;
+
+    void main()
     {
-        row_major float4x4 _134_view : packoffset(c0);
-        row_major float4x4 _134_proj : packoffset(c4);
-        row_major float4x4 _134_model : packoffset(c8);
-        float3 _134_viewpos : packoffset(c12);
-    };
+        gl_Position = ((mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3])) * (mat4(inst_m0, inst_m1, inst_m2, inst_m3) * mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]))) * vec4(position, 1.0);
+        v_uv = uv;
+        v_color = inst_color;
+    }
 
+*/
+static const uint8_t pk_unlit_inst_vs_source_glsl430[758] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x31,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x37,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x28,0x28,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,
+    0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,
+    0x29,0x29,0x20,0x2a,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x30,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x32,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x29,0x20,0x2a,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x29,
+    0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
+    0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
 
-    static float4 gl_Position;
-    static uint4 bone_indices;
-    static float4 weights;
-    static float3 pos;
-    static float3 nrm;
-    static float3 v_pos;
-    static float3 v_normal;
-    static float2 v_uv;
-    static float2 uv;
-    static float3 v_viewpos;
+    uniform vec4 color[1];
+    layout(location = 0) out vec4 frag_color;
+    layout(location = 1) in vec4 v_color;
+    layout(location = 0) in vec2 v_uv;
 
-    struct SPIRV_Cross_Input
+    void main()
     {
-        float3 pos : TEXCOORD0;
-        float3 nrm : TEXCOORD1;
-        float2 uv : TEXCOORD2;
-        uint4 bone_indices : TEXCOORD3;
-        float4 weights : TEXCOORD4;
-    };
+        frag_color = color[0] * v_color;
+    }
 
-    struct SPIRV_Cross_Output
+*/
+static const uint8_t pk_unlit_col_inst_fs_source_glsl430[208] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5b,0x30,0x5d,
+    0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+
+};
+/*
+    #version 430
+
+    layout(binding = 0) uniform sampler2D tex_smp;
+
+    layout(location = 0) in vec2 v_uv;
+    layout(location = 1) in vec4 v_color;
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
     {
-        float3 v_pos : TEXCOORD0;
-        float3 v_normal : TEXCOORD1;
-        float2 v_uv : TEXCOORD2;
-        float3 v_viewpos : TEXCOORD3;
-        float4 gl_Position : SV_Position;
-    };
+        frag_color = texture(tex_smp, v_uv) * v_color;
+    }
 
-    void vert_main()
+*/
+static const uint8_t pk_unlit_tex_inst_fs_source_glsl430[247] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[13];
+    layout(location = 3) in vec4 inst_m0;
+    layout(location = 4) in vec4 inst_m1;
+    layout(location = 5) in vec4 inst_m2;
+    layout(location = 6) in vec4 inst_m3;
+    layout(location = 0) in vec3 position;
+    layout(location = 0) out vec3 v_pos;
+    layout(location = 1) out vec3 v_normal;
+    layout(location = 1) in vec3 normal;
+    layout(location = 2) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 3) out vec3 v_viewpos;
+    layout(location = 4) out vec4 v_color;
+    layout(location = 7) in vec4 inst_color;
+
+    void main()
     {
-        float4x4 _37 = _28_bones[bone_indices.x] * weights.x;
-        float4x4 _45 = _28_bones[bone_indices.y] * weights.y;
-        float4x4 _66 = _28_bones[bone_indices.z] * weights.z;
-        float4x4 _87 = _28_bones[bone_indices.w] * weights.w;
-        float4 _90 = ((_37[0] + _45[0]) + _66[0]) + _87[0];
-        float4 _93 = ((_37[1] + _45[1]) + _66[1]) + _87[1];
-        float4 _96 = ((_37[2] + _45[2]) + _66[2]) + _87[2];
-        float4 _113 = mul(float4(pos, 1.0f), float4x4(_90, _93, _96, ((_37[3] + _45[3]) + _66[3]) + _87[3]));
-        gl_Position = mul(_113, mul(_134_model, mul(_134_view, _134_proj)));
-        v_pos = _113.xyz;
-        v_normal = normalize(mul(nrm, float3x3(_90.xyz, _93.xyz, _96.xyz)));
+        mat4 _44 = mat4(inst_m0, inst_m1, inst_m2, inst_m3) * mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]);
+        vec4 _57 = vec4(position, 1.0);
+        gl_Position = ((mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3])) * _44) * _57;
+        v_pos = vec3((_44 * _57).xyz);
+        v_normal = mat3(_44[0].xyz, _44[1].xyz, _44[2].xyz) * normal;
         v_uv = uv;
-        v_viewpos = _134_viewpos;
+        v_viewpos = vs_params[12].xyz;
+        v_color = inst_color;
     }
 
-    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+*/
+static const uint8_t pk_phong_inst_vs_source_glsl430[1050] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x31,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x37,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,
+    0x20,0x5f,0x34,0x34,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x30,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x32,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x29,0x20,
+    0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x37,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x6d,0x61,0x74,0x34,0x28,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x33,0x5d,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x34,0x29,0x20,0x2a,0x20,
+    0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x5f,0x34,0x34,0x20,0x2a,0x20,0x5f,0x35,0x37,
+    0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x34,0x34,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x34,0x34,0x5b,0x31,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x5f,0x34,0x34,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,
+    0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 dir_light[4];
+    uniform vec4 col_material[4];
+    layout(location = 0) in vec3 v_pos;
+    layout(location = 1) in vec3 v_normal;
+    layout(location = 3) in vec3 v_viewpos;
+    layout(location = 2) in vec2 v_uv;
+    layout(location = 4) in vec4 v_color;
+    layout(location = 0) out vec4 FragColor;
+
+    vec3 phong_light(vec3 v_pos_1, vec3 v_normal_1, vec3 viewpos, vec3 material_ambient, vec3 material_diffuse, vec3 material_specular, float shininess, vec4 tex_color)
     {
-        bone_indices = stage_input.bone_indices;
-        weights = stage_input.weights;
-        pos = stage_input.pos;
-        nrm = stage_input.nrm;
-        uv = stage_input.uv;
-        vert_main();
-        SPIRV_Cross_Output stage_output;
-        stage_output.gl_Position = gl_Position;
-        stage_output.v_pos = v_pos;
-        stage_output.v_normal = v_normal;
-        stage_output.v_uv = v_uv;
-        stage_output.v_viewpos = v_viewpos;
-        return stage_output;
+        vec3 _25 = normalize(v_normal_1);
+        vec3 _41 = normalize(-dir_light[0].xyz);
+        return ((dir_light[1].xyz * material_ambient) + ((dir_light[2].xyz * max(dot(_25, _41), 0.0)) * material_diffuse)) + ((dir_light[3].xyz * pow(max(dot(normalize(viewpos - v_pos_1), reflect(-_41, _25)), 0.0), shininess)) * material_specular);
+    }
+
+    void main()
+    {
+        vec3 param = v_pos;
+        vec3 param_1 = v_normal;
+        vec3 param_2 = v_viewpos;
+        vec3 param_3 = col_material[0].xyz;
+        vec3 param_4 = col_material[1].xyz;
+        vec3 param_5 = col_material[2].xyz;
+        float param_6 = col_material[3].x;
+        vec4 param_7 = vec4(1.0);
+        FragColor = vec4(phong_light(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7), 1.0) * v_color;
     }
+
 */
-static const uint8_t pk_skinned_vs_source_hlsl5[2160] = {
-    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,
-    0x72,0x69,0x63,0x65,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
-    0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
-    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
-    0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x33,0x32,0x5d,0x20,0x3a,0x20,0x70,0x61,
-    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x7d,0x3b,
-    0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,
-    0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
-    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x33,0x34,
-    0x5f,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
-    0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,
-    0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,
-    0x31,0x33,0x34,0x5f,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
-    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
-    0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,
-    0x34,0x20,0x5f,0x31,0x33,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,
-    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x34,0x5f,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
-    0x73,0x65,0x74,0x28,0x63,0x31,0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
-    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
-    0x63,0x65,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x72,0x6d,
-    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,
-    0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x0a,0x73,
-    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x6e,0x72,0x6d,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
-    0x63,0x65,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x77,0x65,0x69,0x67,
-    0x68,0x74,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
-    0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,
-    0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x5f,
-    0x32,0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,
-    0x64,0x69,0x63,0x65,0x73,0x2e,0x78,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,
-    0x74,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x78,0x34,0x20,0x5f,0x34,0x35,0x20,0x3d,0x20,0x5f,0x32,0x38,0x5f,0x62,0x6f,0x6e,
-    0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x2e,
-    0x79,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x79,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x36,0x36,
-    0x20,0x3d,0x20,0x5f,0x32,0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,
-    0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x2e,0x7a,0x5d,0x20,0x2a,0x20,0x77,
-    0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x38,0x37,0x20,0x3d,0x20,0x5f,0x32,0x38,
-    0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
-    0x63,0x65,0x73,0x2e,0x77,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
-    0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x39,0x30,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x37,0x5b,0x30,0x5d,0x20,0x2b,0x20,
-    0x5f,0x34,0x35,0x5b,0x30,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x36,0x36,0x5b,0x30,0x5d,
-    0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x33,0x20,0x3d,0x20,0x28,0x28,0x5f,
-    0x33,0x37,0x5b,0x31,0x5d,0x20,0x2b,0x20,0x5f,0x34,0x35,0x5b,0x31,0x5d,0x29,0x20,
-    0x2b,0x20,0x5f,0x36,0x36,0x5b,0x31,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,
-    0x31,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x39,0x36,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x37,0x5b,0x32,0x5d,0x20,0x2b,0x20,
-    0x5f,0x34,0x35,0x5b,0x32,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x36,0x36,0x5b,0x32,0x5d,
-    0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,0x32,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x31,0x33,0x20,0x3d,0x20,0x6d,0x75,
-    0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,
-    0x30,0x66,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x28,0x5f,0x39,
-    0x30,0x2c,0x20,0x5f,0x39,0x33,0x2c,0x20,0x5f,0x39,0x36,0x2c,0x20,0x28,0x28,0x5f,
-    0x33,0x37,0x5b,0x33,0x5d,0x20,0x2b,0x20,0x5f,0x34,0x35,0x5b,0x33,0x5d,0x29,0x20,
-    0x2b,0x20,0x5f,0x36,0x36,0x5b,0x33,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,
-    0x33,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x31,0x33,
-    0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x33,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,
-    0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x33,0x34,0x5f,0x76,0x69,0x65,0x77,0x2c,
-    0x20,0x5f,0x31,0x33,0x34,0x5f,0x70,0x72,0x6f,0x6a,0x29,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x31,0x31,0x33,0x2e,
-    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,
-    0x6c,0x28,0x6e,0x72,0x6d,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,
-    0x5f,0x39,0x30,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x39,0x33,0x2e,0x78,0x79,0x7a,
-    0x2c,0x20,0x5f,0x39,0x36,0x2e,0x78,0x79,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x31,0x33,
-    0x34,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
-    0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6e,0x65,0x5f,
-    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,
-    0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x20,
-    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x77,0x65,
-    0x69,0x67,0x68,0x74,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x72,0x6d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,
-    0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,
-    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
-    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
-    0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,
-    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+static const uint8_t pk_phong_color_inst_fs_source_glsl430[1209] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x69,0x72,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,
+    0x61,0x6c,0x5b,0x34,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,
+    0x33,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x28,0x76,0x65,
+    0x63,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x61,
+    0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
+    0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x35,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x34,0x31,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x2d,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,
+    0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x28,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
+    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x29,0x20,0x2b,0x20,0x28,0x28,0x64,0x69,0x72,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x32,0x35,0x2c,0x20,0x5f,0x34,0x31,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,
+    0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x29,0x29,0x20,0x2b,0x20,
+    0x28,0x28,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x73,0x20,0x2d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x29,0x2c,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x34,0x31,0x2c,0x20,0x5f,0x32,0x35,
+    0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
+    0x65,0x73,0x73,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,
+    0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,
+    0x32,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x33,0x5d,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 dir_light[4];
+    uniform vec4 tex_material[1];
+    layout(binding = 0) uniform sampler2D col_tex_col_smp;
+
+    layout(location = 2) in vec2 v_uv;
+    layout(location = 0) in vec3 v_pos;
+    layout(location = 1) in vec3 v_normal;
+    layout(location = 3) in vec3 v_viewpos;
+    layout(location = 4) in vec4 v_color;
+    layout(location = 0) out vec4 FragColor;
+
+    vec3 phong_light(vec3 v_pos_1, vec3 v_normal_1, vec3 viewpos, vec3 material_ambient, vec3 material_diffuse, vec3 material_specular, float shininess, vec4 tex_color)
+    {
+        vec3 _25 = normalize(v_normal_1);
+        vec3 _41 = normalize(-dir_light[0].xyz);
+        return ((dir_light[1].xyz * material_ambient) + ((dir_light[2].xyz * max(dot(_25, _41), 0.0)) * material_diffuse)) + ((dir_light[3].xyz * pow(max(dot(normalize(viewpos - v_pos_1), reflect(-_41, _25)), 0.0), shininess)) * material_specular);
+    }
+
+    void main()
+    {
+        vec4 _108 = texture(col_tex_col_smp, v_uv);
+        vec3 param = v_pos;
+        vec3 param_1 = v_normal;
+        vec3 param_2 = v_viewpos;
+        vec3 _130 = _108.xyz;
+        vec3 param_3 = _130;
+        vec3 param_4 = _130;
+        vec3 param_5 = vec3(_108.w);
+        float param_6 = tex_material[0].x;
+        vec4 param_7 = _108;
+        FragColor = vec4(phong_light(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7), 1.0) * v_color;
+    }
+
+*/
+static const uint8_t pk_phong_tex_inst_fs_source_glsl430[1297] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x69,0x72,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,
+    0x61,0x6c,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x63,0x6f,0x6c,
+    0x5f,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x28,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x5f,0x31,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x5f,0x31,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x73,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,
+    0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,
+    0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x31,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x64,0x69,0x72,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x64,0x69,0x72,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x29,
+    0x20,0x2b,0x20,0x28,0x28,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x32,
+    0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x32,0x35,0x2c,0x20,0x5f,0x34,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x64,0x69,0x72,0x5f,0x6c,0x69,
+    0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x70,0x6f,0x77,
+    0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x2d,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x5f,0x31,0x29,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,
+    0x5f,0x34,0x31,0x2c,0x20,0x5f,0x32,0x35,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,
+    0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2a,0x20,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,
+    0x30,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x63,0x6f,0x6c,
+    0x5f,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,
+    0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x5f,0x31,0x33,0x30,0x20,0x3d,0x20,0x5f,0x31,0x30,0x38,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x20,0x3d,0x20,0x5f,0x31,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x31,
+    0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x5f,0x31,0x30,0x38,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,
+    0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,
+    0x31,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x68,0x6f,0x6e,0x67,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[13];
+    uniform vec4 quant_params[2];
+    layout(location = 0) in vec4 position;
+    layout(location = 0) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 1) in vec2 normal;
+
+    void main()
+    {
+        gl_Position = ((mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3])) * mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11])) * vec4((position.xyz * quant_params[0].xyz) + quant_params[1].xyz, 1.0);
+        v_uv = uv;
+    }
+
+*/
+static const uint8_t pk_unlit_packed_vs_source_glsl430[535] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,
+    0x76,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
 
+    uniform vec4 quant_params[2];
+    uniform vec4 vs_params[13];
+    layout(location = 0) in vec4 position;
+    layout(location = 0) out vec3 v_pos;
+    layout(location = 1) out vec3 v_normal;
+    layout(location = 1) in vec2 normal;
+    layout(location = 2) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 3) out vec3 v_viewpos;
+
+    vec3 oct_decode(vec2 e)
+    {
+        vec3 _24 = vec3(e, (1.0 - abs(e.x)) - abs(e.y));
+        vec3 n = _24;
+        float _33 = max(-_24.z, 0.0);
+        n.x = _24.x - (((_24.x >= 0.0) ? 1.0 : (-1.0)) * _33);
+        n.y = _24.y - (((_24.y >= 0.0) ? 1.0 : (-1.0)) * _33);
+        return normalize(n);
+    }
+
+    void main()
+    {
+        vec4 _96 = vec4((position.xyz * quant_params[0].xyz) + quant_params[1].xyz, 1.0);
+        mat4 _107 = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]);
+        gl_Position = ((mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3])) * _107) * _96;
+        v_pos = vec3((_107 * _96).xyz);
+        vec2 param = normal;
+        v_normal = mat3(_107[0].xyz, _107[1].xyz, _107[2].xyz) * oct_decode(param);
+        v_uv = uv;
+        v_viewpos = vs_params[12].xyz;
+    }
+
+*/
+static const uint8_t pk_phong_packed_vs_source_glsl430[1148] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x71,0x75,0x61,0x6e,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,
+    0x5f,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x0a,
+    0x76,0x65,0x63,0x33,0x20,0x6f,0x63,0x74,0x5f,0x64,0x65,0x63,0x6f,0x64,0x65,0x28,
+    0x76,0x65,0x63,0x32,0x20,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x32,0x34,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x65,0x2c,
+    0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x78,0x29,
+    0x29,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x5f,0x32,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,
+    0x20,0x6d,0x61,0x78,0x28,0x2d,0x5f,0x32,0x34,0x2e,0x7a,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x32,0x34,
+    0x2e,0x78,0x20,0x2d,0x20,0x28,0x28,0x28,0x5f,0x32,0x34,0x2e,0x78,0x20,0x3e,0x3d,
+    0x20,0x30,0x2e,0x30,0x29,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x28,0x2d,
+    0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6e,0x2e,0x79,0x20,0x3d,0x20,0x5f,0x32,0x34,0x2e,0x79,0x20,0x2d,0x20,
+    0x28,0x28,0x28,0x5f,0x32,0x34,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x29,
+    0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x28,0x2d,0x31,0x2e,0x30,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x39,0x36,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x71,0x75,
+    0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,
+    0x34,0x20,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x30,0x37,
+    0x29,0x20,0x2a,0x20,0x5f,0x39,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x5f,0x31,0x30,0x37,0x20,
+    0x2a,0x20,0x5f,0x39,0x36,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x31,0x30,0x37,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x31,0x30,0x37,0x5b,0x31,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x5f,0x31,0x30,0x37,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,
+    0x20,0x2a,0x20,0x6f,0x63,0x74,0x5f,0x64,0x65,0x63,0x6f,0x64,0x65,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x32,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
+    cbuffer bone_matrices : register(b1)
+    {
+        row_major float4x4 _28_bones[32] : packoffset(c0);
+    };
+
     cbuffer vs_params : register(b0)
     {
-        row_major float4x4 _20_view : packoffset(c0);
-        row_major float4x4 _20_proj : packoffset(c4);
-        row_major float4x4 _20_model : packoffset(c8);
-        float3 _20_viewpos : packoffset(c12);
+        row_major float4x4 _134_view : packoffset(c0);
+        row_major float4x4 _134_proj : packoffset(c4);
+        row_major float4x4 _134_model : packoffset(c8);
+        float3 _134_viewpos : packoffset(c12);
     };
 
 
     static float4 gl_Position;
-    static float3 position;
+    static uint4 bone_indices;
+    static float4 weights;
+    static float3 pos;
+    static float3 nrm;
+    static float3 v_pos;
+    static float3 v_normal;
+    static float2 v_uv;
+    static float2 uv;
+    static float3 v_viewpos;
 
     struct SPIRV_Cross_Input
     {
-        float3 position : TEXCOORD0;
+        float3 pos : TEXCOORD0;
+        float3 nrm : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+        uint4 bone_indices : TEXCOORD3;
+        float4 weights : TEXCOORD4;
     };
 
     struct SPIRV_Cross_Output
     {
+        float3 v_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float2 v_uv : TEXCOORD2;
+        float3 v_viewpos : TEXCOORD3;
         float4 gl_Position : SV_Position;
     };
 
     void vert_main()
     {
-        gl_Position = mul(float4(position, 1.0f), mul(_20_model, mul(_20_view, _20_proj)));
+        float4x4 _37 = _28_bones[bone_indices.x] * weights.x;
+        float4x4 _45 = _28_bones[bone_indices.y] * weights.y;
+        float4x4 _66 = _28_bones[bone_indices.z] * weights.z;
+        float4x4 _87 = _28_bones[bone_indices.w] * weights.w;
+        float4 _90 = ((_37[0] + _45[0]) + _66[0]) + _87[0];
+        float4 _93 = ((_37[1] + _45[1]) + _66[1]) + _87[1];
+        float4 _96 = ((_37[2] + _45[2]) + _66[2]) + _87[2];
+        float4 _113 = mul(float4(pos, 1.0f), float4x4(_90, _93, _96, ((_37[3] + _45[3]) + _66[3]) + _87[3]));
+        gl_Position = mul(_113, mul(_134_model, mul(_134_view, _134_proj)));
+        v_pos = _113.xyz;
+        v_normal = normalize(mul(nrm, float3x3(_90.xyz, _93.xyz, _96.xyz)));
+        v_uv = uv;
+        v_viewpos = _134_viewpos;
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
-        position = stage_input.position;
+        bone_indices = stage_input.bone_indices;
+        weights = stage_input.weights;
+        pos = stage_input.pos;
+        nrm = stage_input.nrm;
+        uv = stage_input.uv;
         vert_main();
         SPIRV_Cross_Output stage_output;
         stage_output.gl_Position = gl_Position;
+        stage_output.v_pos = v_pos;
+        stage_output.v_normal = v_normal;
+        stage_output.v_uv = v_uv;
+        stage_output.v_viewpos = v_viewpos;
         return stage_output;
     }
 */
-static const uint8_t pk_unlit_col_vs_source_hlsl5[749] = {
-    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,
-    0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
-    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,
-    0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
-    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+static const uint8_t pk_skinned_vs_source_hlsl5[2160] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,
+    0x72,0x69,0x63,0x65,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
     0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
-    0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
-    0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x33,0x32,0x5d,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,
+    0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
+    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x33,0x34,
+    0x5f,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,
+    0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,
+    0x31,0x33,0x34,0x5f,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,
+    0x34,0x20,0x5f,0x31,0x33,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x34,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x72,0x6d,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,
+    0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x6e,0x72,0x6d,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x77,0x65,0x69,0x67,
+    0x68,0x74,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,
+    0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x5f,
+    0x32,0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,
+    0x64,0x69,0x63,0x65,0x73,0x2e,0x78,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,
+    0x74,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x78,0x34,0x20,0x5f,0x34,0x35,0x20,0x3d,0x20,0x5f,0x32,0x38,0x5f,0x62,0x6f,0x6e,
+    0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x2e,
+    0x79,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x79,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x36,0x36,
+    0x20,0x3d,0x20,0x5f,0x32,0x38,0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,
+    0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x2e,0x7a,0x5d,0x20,0x2a,0x20,0x77,
+    0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x38,0x37,0x20,0x3d,0x20,0x5f,0x32,0x38,
+    0x5f,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x2e,0x77,0x5d,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
+    0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x39,0x30,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x37,0x5b,0x30,0x5d,0x20,0x2b,0x20,
+    0x5f,0x34,0x35,0x5b,0x30,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x36,0x36,0x5b,0x30,0x5d,
+    0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x33,0x20,0x3d,0x20,0x28,0x28,0x5f,
+    0x33,0x37,0x5b,0x31,0x5d,0x20,0x2b,0x20,0x5f,0x34,0x35,0x5b,0x31,0x5d,0x29,0x20,
+    0x2b,0x20,0x5f,0x36,0x36,0x5b,0x31,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x39,0x36,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x37,0x5b,0x32,0x5d,0x20,0x2b,0x20,
+    0x5f,0x34,0x35,0x5b,0x32,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x36,0x36,0x5b,0x32,0x5d,
+    0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,0x32,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x31,0x33,0x20,0x3d,0x20,0x6d,0x75,
+    0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x28,0x5f,0x39,
+    0x30,0x2c,0x20,0x5f,0x39,0x33,0x2c,0x20,0x5f,0x39,0x36,0x2c,0x20,0x28,0x28,0x5f,
+    0x33,0x37,0x5b,0x33,0x5d,0x20,0x2b,0x20,0x5f,0x34,0x35,0x5b,0x33,0x5d,0x29,0x20,
+    0x2b,0x20,0x5f,0x36,0x36,0x5b,0x33,0x5d,0x29,0x20,0x2b,0x20,0x5f,0x38,0x37,0x5b,
+    0x33,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x31,0x33,
+    0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x33,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,
+    0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x33,0x34,0x5f,0x76,0x69,0x65,0x77,0x2c,
+    0x20,0x5f,0x31,0x33,0x34,0x5f,0x70,0x72,0x6f,0x6a,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x31,0x31,0x33,0x2e,
+    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,
+    0x6c,0x28,0x6e,0x72,0x6d,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,
+    0x5f,0x39,0x30,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x39,0x33,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x5f,0x39,0x36,0x2e,0x78,0x79,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x31,0x33,
+    0x34,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6e,0x65,0x5f,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,
+    0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x72,0x6d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+
+};
+/*
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _20_view : packoffset(c0);
+        row_major float4x4 _20_proj : packoffset(c4);
+        row_major float4x4 _20_model : packoffset(c8);
+        float3 _20_viewpos : packoffset(c12);
+    };
+
+
+    static float4 gl_Position;
+    static float3 position;
+
+    struct SPIRV_Cross_Input
+    {
+        float3 position : TEXCOORD0;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        gl_Position = mul(float4(position, 1.0f), mul(_20_model, mul(_20_view, _20_proj)));
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        position = stage_input.position;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        return stage_output;
+    }
+*/
+static const uint8_t pk_unlit_col_vs_source_hlsl5[749] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
+    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
     0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
     0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
     0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
@@ -2027,987 +2772,1297 @@ static const uint8_t pk_phong_tex_fs_source_hlsl5[2014] = {
     0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    alias Arr = array<mat4x4f, 32u>;
-
-    struct bone_matrices {
-      /_ @offset(0) _/
-      bones : Arr,
-    }
-
-    struct vs_params {
-      /_ @offset(0) _/
-      view : mat4x4f,
-      /_ @offset(64) _/
-      proj : mat4x4f,
-      /_ @offset(128) _/
-      model : mat4x4f,
-      /_ @offset(192) _/
-      viewpos : vec3f,
-    }
-
-    var<private> bone_indices : vec4u;
-
-    var<private> weights : vec4f;
-
-    @binding(1) @group(0) var<uniform> x_28 : bone_matrices;
-
-    var<private> pos : vec3f;
-
-    var<private> nrm : vec3f;
-
-    @binding(0) @group(0) var<uniform> x_134 : vs_params;
-
-    var<private> v_pos : vec3f;
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _20_view : packoffset(c0);
+        row_major float4x4 _20_proj : packoffset(c4);
+        row_major float4x4 _20_model : packoffset(c8);
+        float3 _20_viewpos : packoffset(c12);
+    };
 
-    var<private> v_normal : vec3f;
 
-    var<private> v_uv : vec2f;
+    static float4 gl_Position;
+    static float4 inst_m0;
+    static float4 inst_m1;
+    static float4 inst_m2;
+    static float4 inst_m3;
+    static float3 position;
+    static float2 v_uv;
+    static float2 uv;
+    static float4 v_color;
+    static float4 inst_color;
+    static float3 normal;
 
-    var<private> uv : vec2f;
+    struct SPIRV_Cross_Input
+    {
+        float3 position : TEXCOORD0;
+        float3 normal : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+        float4 inst_m0 : TEXCOORD3;
+        float4 inst_m1 : TEXCOORD4;
+        float4 inst_m2 : TEXCOORD5;
+        float4 inst_m3 : TEXCOORD6;
+        float4 inst_color : TEXCOORD7;
+    };
 
-    var<private> v_viewpos : vec3f;
+    struct SPIRV_Cross_Output
+    {
+        float2 v_uv : TEXCOORD0;
+        float4 v_color : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
 
-    var<private> gl_Position : vec4f;
+    void vert_main()
+    {
+        gl_Position = mul(float4(position, 1.0f), mul(mul(_20_model, float4x4(inst_m0, inst_m1, inst_m2, inst_m3)), mul(_20_view, _20_proj)));
+        v_uv = uv;
+        v_color = inst_color;
+    }
 
-    fn main_1() {
-      var idx : vec4u;
-      var skin_mat : mat4x4f;
-      var skinned_pos : vec4f;
-      var skinned_nrm : vec3f;
-      idx = bone_indices;
-      let x_37 = (x_28.bones[idx.x] * weights.x);
-      let x_45 = (x_28.bones[idx.y] * weights.y);
-      let x_58 = mat4x4f((x_37[0u] + x_45[0u]), (x_37[1u] + x_45[1u]), (x_37[2u] + x_45[2u]), (x_37[3u] + x_45[3u]));
-      let x_66 = (x_28.bones[idx.z] * weights.z);
-      let x_79 = mat4x4f((x_58[0u] + x_66[0u]), (x_58[1u] + x_66[1u]), (x_58[2u] + x_66[2u]), (x_58[3u] + x_66[3u]));
-      let x_87 = (x_28.bones[idx.w] * weights.w);
-      skin_mat = mat4x4f((x_79[0u] + x_87[0u]), (x_79[1u] + x_87[1u]), (x_79[2u] + x_87[2u]), (x_79[3u] + x_87[3u]));
-      skinned_pos = (skin_mat * vec4f(pos.x, pos.y, pos.z, 1.0f));
-      skinned_nrm = (mat3x3f(skin_mat[0u].xyz, skin_mat[1u].xyz, skin_mat[2u].xyz) * nrm);
-      gl_Position = (((x_134.proj * x_134.view) * x_134.model) * skinned_pos);
-      v_pos = skinned_pos.xyz;
-      v_normal = normalize(skinned_nrm);
-      v_uv = uv;
-      v_viewpos = x_134.viewpos;
-      return;
-    }
-
-    struct main_out {
-      @builtin(position)
-      gl_Position : vec4f,
-      @location(0)
-      v_pos_1 : vec3f,
-      @location(1)
-      v_normal_1 : vec3f,
-      @location(2)
-      v_uv_1 : vec2f,
-      @location(3)
-      v_viewpos_1 : vec3f,
-    }
-
-    @vertex
-    fn main(@location(3) @interpolate(flat) bone_indices_param : vec4u, @location(4) weights_param : vec4f, @location(0) pos_param : vec3f, @location(1) nrm_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
-      bone_indices = bone_indices_param;
-      weights = weights_param;
-      pos = pos_param;
-      nrm = nrm_param;
-      uv = uv_param;
-      main_1();
-      return main_out(gl_Position, v_pos, v_normal, v_uv, v_viewpos);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        inst_m0 = stage_input.inst_m0;
+        inst_m1 = stage_input.inst_m1;
+        inst_m2 = stage_input.inst_m2;
+        inst_m3 = stage_input.inst_m3;
+        position = stage_input.position;
+        uv = stage_input.uv;
+        inst_color = stage_input.inst_color;
+        normal = stage_input.normal;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_uv = v_uv;
+        stage_output.v_color = v_color;
+        return stage_output;
     }
 */
-static const uint8_t pk_skinned_vs_source_wgsl[2362] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x61,0x6c,0x69,0x61,0x73,0x20,0x41,
-    0x72,0x72,0x20,0x3d,0x20,0x61,0x72,0x72,0x61,0x79,0x3c,0x6d,0x61,0x74,0x34,0x78,
-    0x34,0x66,0x2c,0x20,0x33,0x32,0x75,0x3e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
-    0x74,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,0x72,0x69,0x63,0x65,0x73,0x20,
-    0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,
-    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x62,0x6f,0x6e,0x65,0x73,0x20,0x3a,0x20,0x41,
-    0x72,0x72,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,
-    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,
-    0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
-    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,0x29,0x20,
-    0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,
-    0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,
-    0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,0x64,0x65,
-    0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,
-    0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,0x20,0x2a,
-    0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
-    0x61,0x74,0x65,0x3e,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
-    0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
-    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
-    0x69,0x6e,0x67,0x28,0x31,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,
-    0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,
-    0x32,0x38,0x20,0x3a,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,0x72,0x69,0x63,
-    0x65,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x72,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
-    0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,
-    0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,
-    0x31,0x33,0x34,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,
-    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
-    0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
-    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
-    0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x69,0x64,0x78,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
-    0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,
-    0x34,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,
-    0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,
-    0x20,0x76,0x61,0x72,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x69,0x64,0x78,0x20,
-    0x3d,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x37,0x20,0x3d,0x20,0x28,0x78,0x5f,
-    0x32,0x38,0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x78,0x5d,0x20,
-    0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,
-    0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x35,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
-    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x79,0x5d,0x20,0x2a,0x20,
-    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
-    0x74,0x20,0x78,0x5f,0x35,0x38,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
-    0x28,0x28,0x78,0x5f,0x33,0x37,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,
-    0x35,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x33,0x37,0x5b,0x31,0x75,
-    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
-    0x78,0x5f,0x33,0x37,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,
-    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x33,0x37,0x5b,0x33,0x75,0x5d,0x20,
-    0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x36,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
-    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x7a,0x5d,0x20,0x2a,0x20,
-    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
-    0x74,0x20,0x78,0x5f,0x37,0x39,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
-    0x28,0x28,0x78,0x5f,0x35,0x38,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,
-    0x36,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x35,0x38,0x5b,0x31,0x75,
-    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
-    0x78,0x5f,0x35,0x38,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,
-    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x35,0x38,0x5b,0x33,0x75,0x5d,0x20,
-    0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
-    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x77,0x5d,0x20,0x2a,0x20,
-    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x73,0x6b,
-    0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
-    0x28,0x28,0x78,0x5f,0x37,0x39,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,
-    0x37,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x37,0x39,0x5b,0x31,0x75,
-    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
-    0x78,0x5f,0x37,0x39,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,
-    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x37,0x39,0x5b,0x33,0x75,0x5d,0x20,
-    0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x73,
-    0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,
-    0x70,0x6f,0x73,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x2e,0x79,0x2c,0x20,0x70,0x6f,
-    0x73,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,
-    0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x28,0x6d,0x61,
-    0x74,0x33,0x78,0x33,0x66,0x28,0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x5b,0x30,
-    0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,
-    0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x73,0x6b,0x69,0x6e,0x5f,0x6d,
-    0x61,0x74,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x6e,0x72,
-    0x6d,0x29,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x31,0x33,0x34,0x2e,0x70,0x72,0x6f,
-    0x6a,0x20,0x2a,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,
-    0x2a,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,
-    0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,
-    0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,
-    0x5f,0x70,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-    0x28,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,0x29,0x3b,0x0a,0x20,
-    0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x76,0x5f,
-    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,
-    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
-    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,
-    0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
-    0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
-    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,
-    0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
-    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,
-    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,
-    0x29,0x20,0x40,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x28,0x66,
-    0x6c,0x61,0x74,0x29,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
-    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x2c,
-    0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,0x29,0x20,0x77,0x65,
-    0x69,0x67,0x68,0x74,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
-    0x29,0x20,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,
-    0x29,0x20,0x6e,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,
-    0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
-    0x7b,0x0a,0x20,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,
-    0x20,0x3d,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
-    0x20,0x3d,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x70,0x6f,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x6e,0x72,0x6d,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,
-    0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,
-    0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,
-    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x76,0x5f,0x76,0x69,0x65,
-    0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+static const uint8_t pk_unlit_inst_vs_source_hlsl5[1629] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
+    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
+    0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x6d,0x75,0x6c,0x28,0x6d,0x75,0x6c,0x28,0x5f,
+    0x32,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x78,0x34,0x28,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x2c,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x2c,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x33,0x29,0x29,0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x30,
+    0x5f,0x76,0x69,0x65,0x77,0x2c,0x20,0x5f,0x32,0x30,0x5f,0x70,0x72,0x6f,0x6a,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    struct vs_params {
-      /_ @offset(0) _/
-      view : mat4x4f,
-      /_ @offset(64) _/
-      proj : mat4x4f,
-      /_ @offset(128) _/
-      model : mat4x4f,
-      /_ @offset(192) _/
-      viewpos : vec3f,
-    }
+    cbuffer color : register(b1)
+    {
+        float4 _12_col : packoffset(c0);
+    };
 
-    @binding(0) @group(0) var<uniform> x_20 : vs_params;
 
-    var<private> position_1 : vec3f;
+    static float4 frag_color;
+    static float4 v_color;
+    static float2 v_uv;
 
-    var<private> gl_Position : vec4f;
+    struct SPIRV_Cross_Input
+    {
+        float2 v_uv : TEXCOORD0;
+        float4 v_color : TEXCOORD1;
+    };
 
-    fn main_1() {
-      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      return;
-    }
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
 
-    struct main_out {
-      @builtin(position)
-      gl_Position : vec4f,
+    void frag_main()
+    {
+        frag_color = _12_col * v_color;
     }
 
-    @vertex
-    fn main(@location(0) position_1_param : vec3f) -> main_out {
-      position_1 = position_1_param;
-      main_1();
-      return main_out(gl_Position);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_color = stage_input.v_color;
+        v_uv = stage_input.v_uv;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
     }
 */
-static const uint8_t pk_unlit_col_vs_source_wgsl[696] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
-    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
-    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
-    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
-    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
-    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
-    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
-    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
-    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
-    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
-    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
-    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
-    0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x20,
-    0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,0x20,0x78,
-    0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x78,0x2c,
-    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,0x20,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,
-    0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,
-    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
-    0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
-    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
-    0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,
-    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
-    0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,
-    0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,
-    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+static const uint8_t pk_unlit_col_inst_fs_source_hlsl5[606] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x32,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x5f,0x31,0x32,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    struct color {
-      /_ @offset(0) _/
-      col : vec4f,
-    }
+    Texture2D<float4> tex : register(t0);
+    SamplerState smp : register(s0);
 
-    var<private> frag_color : vec4f;
+    static float2 v_uv;
+    static float4 v_color;
+    static float4 frag_color;
 
-    @binding(9) @group(0) var<uniform> x_12 : color;
+    struct SPIRV_Cross_Input
+    {
+        float2 v_uv : TEXCOORD0;
+        float4 v_color : TEXCOORD1;
+    };
 
-    fn main_1() {
-      frag_color = x_12.col;
-      return;
-    }
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
 
-    struct main_out {
-      @location(0)
-      frag_color_1 : vec4f,
+    void frag_main()
+    {
+        frag_color = tex.Sample(smp, v_uv) * v_color;
     }
 
-    @fragment
-    fn main() -> main_out {
-      main_1();
-      return main_out(frag_color);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_uv = stage_input.v_uv;
+        v_color = stage_input.v_color;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
     }
 */
-static const uint8_t pk_unlit_col_fs_source_wgsl[369] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
-    0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x63,0x6f,0x6c,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,
-    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
-    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,
-    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x39,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,
-    0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-    0x3e,0x20,0x78,0x5f,0x31,0x32,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
-    0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,
-    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x78,0x5f,
-    0x31,0x32,0x2e,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,
-    0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,
-    0x69,0x6e,0x28,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
-    0x20,0x7b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
-    0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x00,
+static const uint8_t pk_unlit_tex_inst_fs_source_hlsl5[619] = {
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,
+    0x74,0x65,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
+    0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    struct vs_params {
-      /_ @offset(0) _/
-      view : mat4x4f,
-      /_ @offset(64) _/
-      proj : mat4x4f,
-      /_ @offset(128) _/
-      model : mat4x4f,
-      /_ @offset(192) _/
-      viewpos : vec3f,
-    }
-
-    @binding(0) @group(0) var<uniform> x_20 : vs_params;
-
-    var<private> position_1 : vec3f;
-
-    var<private> v_uv : vec2f;
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _20_view : packoffset(c0);
+        row_major float4x4 _20_proj : packoffset(c4);
+        row_major float4x4 _20_model : packoffset(c8);
+        float3 _20_viewpos : packoffset(c12);
+    };
 
-    var<private> uv : vec2f;
 
-    var<private> normal : vec3f;
+    static float4 gl_Position;
+    static float4 inst_m0;
+    static float4 inst_m1;
+    static float4 inst_m2;
+    static float4 inst_m3;
+    static float3 position;
+    static float3 v_pos;
+    static float3 v_normal;
+    static float3 normal;
+    static float2 v_uv;
+    static float2 uv;
+    static float3 v_viewpos;
+    static float4 v_color;
+    static float4 inst_color;
 
-    var<private> gl_Position : vec4f;
+    struct SPIRV_Cross_Input
+    {
+        float3 position : TEXCOORD0;
+        float3 normal : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+        float4 inst_m0 : TEXCOORD3;
+        float4 inst_m1 : TEXCOORD4;
+        float4 inst_m2 : TEXCOORD5;
+        float4 inst_m3 : TEXCOORD6;
+        float4 inst_color : TEXCOORD7;
+    };
 
-    fn main_1() {
-      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      v_uv = uv;
-      return;
-    }
+    struct SPIRV_Cross_Output
+    {
+        float3 v_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float2 v_uv : TEXCOORD2;
+        float3 v_viewpos : TEXCOORD3;
+        float4 v_color : TEXCOORD4;
+        float4 gl_Position : SV_Position;
+    };
 
-    struct main_out {
-      @builtin(position)
-      gl_Position : vec4f,
-      @location(0)
-      v_uv_1 : vec2f,
+    void vert_main()
+    {
+        float4x4 _44 = mul(_20_model, float4x4(inst_m0, inst_m1, inst_m2, inst_m3));
+        float4 _57 = float4(position, 1.0f);
+        gl_Position = mul(_57, mul(_44, mul(_20_view, _20_proj)));
+        v_pos = float3(mul(_57, _44).xyz);
+        v_normal = mul(normal, float3x3(_44[0].xyz, _44[1].xyz, _44[2].xyz));
+        v_uv = uv;
+        v_viewpos = _20_viewpos;
+        v_color = inst_color;
     }
 
-    @vertex
-    fn main(@location(0) position_1_param : vec3f, @location(2) uv_param : vec2f, @location(1) normal_param : vec3f) -> main_out {
-      position_1 = position_1_param;
-      uv = uv_param;
-      normal = normal_param;
-      main_1();
-      return main_out(gl_Position, v_uv);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        inst_m0 = stage_input.inst_m0;
+        inst_m1 = stage_input.inst_m1;
+        inst_m2 = stage_input.inst_m2;
+        inst_m3 = stage_input.inst_m3;
+        position = stage_input.position;
+        normal = stage_input.normal;
+        uv = stage_input.uv;
+        inst_color = stage_input.inst_color;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_pos = v_pos;
+        stage_output.v_normal = v_normal;
+        stage_output.v_uv = v_uv;
+        stage_output.v_viewpos = v_viewpos;
+        stage_output.v_color = v_color;
+        return stage_output;
     }
 */
-static const uint8_t pk_unlit_tex_vs_source_wgsl[940] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
-    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
-    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
-    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
-    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
-    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
-    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
-    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
-    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
-    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
-    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
-    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
-    0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,
-    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
-    0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
-    0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,
-    0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,
-    0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
-    0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
-    0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,
-    0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,
-    0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,
-    0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,
-    0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,
-    0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
-    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,
-    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
-    0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,
-    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,
-    0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,
-    0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
-};
-/*
-    diagnostic(off, derivative_uniformity);
-
-    @binding(64) @group(1) var tex : texture_2d<f32>;
-
-    @binding(65) @group(1) var smp : sampler;
-
-    var<private> v_uv : vec2f;
-
-    var<private> frag_color : vec4f;
-
-    fn main_1() {
-      var col : vec4f;
-      let x_23 = v_uv;
-      let x_24 = textureSample(tex, smp, x_23);
-      col = x_24;
-      frag_color = col;
-      return;
-    }
-
-    struct main_out {
-      @location(0)
-      frag_color_1 : vec4f,
-    }
-
-    @fragment
-    fn main(@location(0) v_uv_param : vec2f) -> main_out {
-      v_uv = v_uv_param;
-      main_1();
-      return main_out(frag_color);
-    }
-*/
-static const uint8_t pk_unlit_tex_fs_source_wgsl[532] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,
-    0x67,0x28,0x36,0x34,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,
-    0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,
-    0x64,0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
-    0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
-    0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
-    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
-    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
-    0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x33,
-    0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
-    0x5f,0x32,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,
-    0x32,0x33,0x29,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x32,
-    0x34,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,
-    0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
-    0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,
-    0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,
-    0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,
-    0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
-    0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
-    0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
-    0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
-    0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,
-    0x0a,0x7d,0x0a,0x00,
+static const uint8_t pk_phong_inst_vs_source_hlsl5[2094] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
+    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
+    0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x31,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x32,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x33,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x37,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x34,0x34,
+    0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x28,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x30,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x32,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x37,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,
+    0x5f,0x35,0x37,0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x34,0x34,0x2c,0x20,0x6d,0x75,
+    0x6c,0x28,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x2c,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6d,0x75,0x6c,0x28,
+    0x5f,0x35,0x37,0x2c,0x20,0x5f,0x34,0x34,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,
+    0x75,0x6c,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x78,0x33,0x28,0x5f,0x34,0x34,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x5f,0x34,0x34,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x34,0x34,0x5b,
+    0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,
+    0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,
+    0x6e,0x73,0x74,0x5f,0x6d,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x5f,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    struct vs_params {
-      /_ @offset(0) _/
-      view : mat4x4f,
-      /_ @offset(64) _/
-      proj : mat4x4f,
-      /_ @offset(128) _/
-      model : mat4x4f,
-      /_ @offset(192) _/
-      viewpos : vec3f,
-    }
-
-    @binding(0) @group(0) var<uniform> x_20 : vs_params;
-
-    var<private> position_1 : vec3f;
-
-    var<private> v_pos : vec3f;
+    cbuffer dir_light : register(b3)
+    {
+        float3 light_direction : packoffset(c0);
+        float4 light_ambient : packoffset(c1);
+        float4 light_diffuse : packoffset(c2);
+        float4 light_specular : packoffset(c3);
+    };
 
-    var<private> v_normal : vec3f;
+    cbuffer col_material : register(b2)
+    {
+        float4 col_mat_ambient : packoffset(c0);
+        float4 col_mat_diffuse : packoffset(c1);
+        float4 col_mat_specular : packoffset(c2);
+        float col_mat_shininess : packoffset(c3);
+    };
 
-    var<private> normal : vec3f;
 
-    var<private> v_viewpos : vec3f;
+    static float3 v_pos;
+    static float3 v_normal;
+    static float3 v_viewpos;
+    static float4 v_color;
+    static float2 v_uv;
+    static float4 FragColor;
 
-    var<private> uv : vec2f;
+    struct SPIRV_Cross_Input
+    {
+        float3 v_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float2 v_uv : TEXCOORD2;
+        float3 v_viewpos : TEXCOORD3;
+        float4 v_color : TEXCOORD4;
+    };
 
-    var<private> gl_Position : vec4f;
+    struct SPIRV_Cross_Output
+    {
+        float4 FragColor : SV_Target0;
+    };
 
-    fn main_1() {
-      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      let x_52 = (x_20.model * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      v_pos = vec3f(x_52.x, x_52.y, x_52.z);
-      let x_59 = x_20.model;
-      v_normal = (mat3x3f(x_59[0u].xyz, x_59[1u].xyz, x_59[2u].xyz) * normal);
-      v_viewpos = x_20.viewpos;
-      return;
+    float3 phong_light(float3 v_pos_1, float3 v_normal_1, float3 viewpos, float3 material_ambient, float3 material_diffuse, float3 material_specular, float shininess, float4 tex_color)
+    {
+        float3 _25 = normalize(v_normal_1);
+        float3 _41 = normalize(-light_direction);
+        return ((light_ambient.xyz * material_ambient) + ((light_diffuse.xyz * max(dot(_25, _41), 0.0f)) * material_diffuse)) + ((light_specular.xyz * pow(max(dot(normalize(viewpos - v_pos_1), reflect(-_41, _25)), 0.0f), shininess)) * material_specular);
     }
 
-    struct main_out {
-      @builtin(position)
-      gl_Position : vec4f,
-      @location(0)
-      v_pos_1 : vec3f,
-      @location(1)
-      v_normal_1 : vec3f,
-      @location(2)
-      v_viewpos_1 : vec3f,
+    void frag_main()
+    {
+        float3 param = v_pos;
+        float3 param_1 = v_normal;
+        float3 param_2 = v_viewpos;
+        float3 param_3 = col_mat_ambient.xyz;
+        float3 param_4 = col_mat_diffuse.xyz;
+        float3 param_5 = col_mat_specular.xyz;
+        float param_6 = col_mat_shininess;
+        float4 param_7 = 1.0f.xxxx;
+        FragColor = float4(phong_light(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7), 1.0f) * v_color;
     }
 
-    @vertex
-    fn main(@location(0) position_1_param : vec3f, @location(1) normal_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
-      position_1 = position_1_param;
-      normal = normal_param;
-      uv = uv_param;
-      main_1();
-      return main_out(gl_Position, v_pos, v_normal, v_viewpos);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_pos = stage_input.v_pos;
+        v_normal = stage_input.v_normal;
+        v_viewpos = stage_input.v_viewpos;
+        v_color = stage_input.v_color;
+        v_uv = stage_input.v_uv;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.FragColor = FragColor;
+        return stage_output;
     }
 */
-static const uint8_t pk_phong_color_vs_source_wgsl[1343] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
-    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
-    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
-    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
-    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
-    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
-    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
-    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
-    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
-    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
-    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
-    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
-    0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
-    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
-    0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,
-    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
-    0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,
-    0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,
-    0x2e,0x70,0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,
-    0x77,0x29,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,
-    0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
-    0x31,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
-    0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
-    0x20,0x78,0x5f,0x35,0x32,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,
-    0x64,0x65,0x6c,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,
-    0x35,0x32,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x79,0x2c,0x20,0x78,0x5f,
-    0x35,0x32,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,
-    0x39,0x20,0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x3b,0x0a,
-    0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,
-    0x74,0x33,0x78,0x33,0x66,0x28,0x78,0x5f,0x35,0x39,0x5b,0x30,0x75,0x5d,0x2e,0x78,
-    0x79,0x7a,0x2c,0x20,0x78,0x5f,0x35,0x39,0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,
-    0x2c,0x20,0x78,0x5f,0x35,0x39,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,
-    0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,
-    0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,
-    0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,
-    0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
-    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,
-    0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
-    0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
-    0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,
-    0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,
-    0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,
-    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,
-    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
-    0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,
-    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
-    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+static const uint8_t pk_phong_color_inst_fs_source_hlsl5[2139] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x33,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x32,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x61,
+    0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x5f,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6d,
+    0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
+    0x65,0x73,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x65,0x78,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x69,0x7a,0x65,0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x31,0x20,
+    0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x6c,0x69,0x67,
+    0x68,0x74,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,
+    0x29,0x20,0x2b,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x32,0x35,0x2c,0x20,0x5f,0x34,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x66,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x6c,0x69,0x67,
+    0x68,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
+    0x2d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x29,0x2c,0x20,0x72,0x65,0x66,0x6c,
+    0x65,0x63,0x74,0x28,0x2d,0x5f,0x34,0x31,0x2c,0x20,0x5f,0x32,0x35,0x29,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+    0x73,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,
+    0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,
+    0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x76,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,
+    0x6d,0x61,0x74,0x5f,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x20,0x2a,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    diagnostic(off, derivative_uniformity);
-
-    struct dir_light {
-      /_ @offset(0) _/
-      direction : vec3f,
-      /_ @offset(16) _/
-      ambient : vec4f,
-      /_ @offset(32) _/
-      diffuse : vec4f,
-      /_ @offset(48) _/
-      specular : vec4f,
-    }
+    cbuffer dir_light : register(b3)
+    {
+        float3 light_direction : packoffset(c0);
+        float4 light_ambient : packoffset(c1);
+        float4 light_diffuse : packoffset(c2);
+        float4 light_specular : packoffset(c3);
+    };
 
-    struct col_material {
-      /_ @offset(0) _/
-      ambient : vec4f,
-      /_ @offset(16) _/
-      diffuse : vec4f,
-      /_ @offset(32) _/
-      specular : vec4f,
-      /_ @offset(48) _/
-      shininess : f32,
-    }
+    cbuffer tex_material : register(b2)
+    {
+        float tex_mat_shininess : packoffset(c0);
+    };
 
-    @binding(11) @group(0) var<uniform> light : dir_light;
+    Texture2D<float4> col_tex : register(t0);
+    SamplerState col_smp : register(s0);
 
-    var<private> v_pos_1 : vec3f;
+    static float2 v_uv;
+    static float3 v_pos;
+    static float3 v_normal;
+    static float3 v_viewpos;
+    static float4 v_color;
+    static float4 FragColor;
 
-    var<private> v_normal_1 : vec3f;
+    struct SPIRV_Cross_Input
+    {
+        float3 v_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float2 v_uv : TEXCOORD2;
+        float3 v_viewpos : TEXCOORD3;
+        float4 v_color : TEXCOORD4;
+    };
 
-    var<private> v_viewpos : vec3f;
+    struct SPIRV_Cross_Output
+    {
+        float4 FragColor : SV_Target0;
+    };
 
-    @binding(10) @group(0) var<uniform> col_mat : col_material;
+    float3 phong_light(float3 v_pos_1, float3 v_normal_1, float3 viewpos, float3 material_ambient, float3 material_diffuse, float3 material_specular, float shininess, float4 tex_color)
+    {
+        float3 _25 = normalize(v_normal_1);
+        float3 _41 = normalize(-light_direction);
+        return ((light_ambient.xyz * material_ambient) + ((light_diffuse.xyz * max(dot(_25, _41), 0.0f)) * material_diffuse)) + ((light_specular.xyz * pow(max(dot(normalize(viewpos - v_pos_1), reflect(-_41, _25)), 0.0f), shininess)) * material_specular);
+    }
 
-    var<private> FragColor : vec4f;
+    void frag_main()
+    {
+        float4 _108 = col_tex.Sample(col_smp, v_uv);
+        float3 param = v_pos;
+        float3 param_1 = v_normal;
+        float3 param_2 = v_viewpos;
+        float3 _130 = _108.xyz;
+        float3 param_3 = _130;
+        float3 param_4 = _130;
+        float3 param_5 = _108.w.xxx;
+        float param_6 = tex_mat_shininess;
+        float4 param_7 = _108;
+        FragColor = float4(phong_light(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7), 1.0f) * v_color;
+    }
 
-    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
-      var norm : vec3f;
-      var view_dir : vec3f;
-      var light_dir : vec3f;
-      var diff : f32;
-      var reflect_dir : vec3f;
-      var spec : f32;
-      var ambient : vec3f;
-      var diffuse : vec3f;
-      var specular : vec3f;
-      norm = normalize(*(v_normal));
-      view_dir = normalize((*(viewpos) - *(v_pos)));
-      light_dir = normalize(-(light.direction));
-      diff = max(dot(norm, light_dir), 0.0f);
-      reflect_dir = reflect(-(light_dir), norm);
-      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
-      ambient = (light.ambient.xyz * *(material_ambient));
-      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
-      specular = ((light.specular.xyz * spec) * *(material_specular));
-      let x_86 = ambient;
-      let x_87 = diffuse;
-      let x_89 = specular;
-      return ((x_86 + x_87) + x_89);
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_uv = stage_input.v_uv;
+        v_pos = stage_input.v_pos;
+        v_normal = stage_input.v_normal;
+        v_viewpos = stage_input.v_viewpos;
+        v_color = stage_input.v_color;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.FragColor = FragColor;
+        return stage_output;
     }
+*/
+static const uint8_t pk_phong_tex_inst_fs_source_hlsl5[2114] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x33,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x74,0x65,
+    0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x32,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x5f,0x73,0x68,
+    0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,
+    0x63,0x6f,0x6c,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,
+    0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,
+    0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,
+    0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,
+    0x6d,0x62,0x69,0x65,0x6e,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6d,
+    0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x34,0x31,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
+    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x29,0x20,0x2b,0x20,0x28,0x28,0x6c,0x69,0x67,
+    0x68,0x74,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x32,0x35,0x2c,0x20,0x5f,0x34,
+    0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,
+    0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x2d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,
+    0x29,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x34,0x31,0x2c,
+    0x20,0x5f,0x32,0x35,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x73,
+    0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x31,0x30,0x38,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x74,0x65,0x78,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x30,
+    0x20,0x3d,0x20,0x5f,0x31,0x30,0x38,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,
+    0x3d,0x20,0x5f,0x31,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x31,0x33,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x5f,0x31,0x30,0x38,0x2e,0x77,0x2e,0x78,
+    0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x5f,
+    0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,
+    0x5f,0x31,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x68,0x6f,
+    0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x29,0x20,0x2a,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x00,
+};
+/*
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _20_view : packoffset(c0);
+        row_major float4x4 _20_proj : packoffset(c4);
+        row_major float4x4 _20_model : packoffset(c8);
+        float3 _20_viewpos : packoffset(c12);
+    };
 
-    fn main_1() {
-      var result : vec3f;
-      var param : vec3f;
-      var param_1 : vec3f;
-      var param_2 : vec3f;
-      var param_3 : vec3f;
-      var param_4 : vec3f;
-      var param_5 : vec3f;
-      var param_6 : f32;
-      var param_7 : vec4f;
-      param = v_pos_1;
-      param_1 = v_normal_1;
-      param_2 = v_viewpos;
-      param_3 = col_mat.ambient.xyz;
-      param_4 = col_mat.diffuse.xyz;
-      param_5 = col_mat.specular.xyz;
-      param_6 = col_mat.shininess;
-      param_7 = vec4f(1.0f);
-      let x_126 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
-      result = x_126;
-      FragColor = vec4f(result.x, result.y, result.z, 1.0f);
-      return;
+    cbuffer quant_params : register(b4)
+    {
+        float3 _38_pos_scale : packoffset(c0);
+        float3 _38_pos_offset : packoffset(c1);
+    };
+
+
+    static float4 gl_Position;
+    static float4 position;
+    static float2 v_uv;
+    static float2 uv;
+    static float2 normal;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 position : TEXCOORD0;
+        float2 normal : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 v_uv : TEXCOORD0;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        gl_Position = mul(float4((position.xyz * _38_pos_scale) + _38_pos_offset, 1.0f), mul(_20_model, mul(_20_view, _20_proj)));
+        v_uv = uv;
     }
 
-    struct main_out {
-      @location(0)
-      FragColor_1 : vec4f,
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        position = stage_input.position;
+        uv = stage_input.uv;
+        normal = stage_input.normal;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_uv = v_uv;
+        return stage_output;
     }
+*/
+static const uint8_t pk_unlit_packed_vs_source_hlsl5[1167] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,
+    0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
+    0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
+    0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x34,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x5f,0x70,0x6f,0x73,
+    0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x5f,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x33,0x38,0x5f,0x70,0x6f,0x73,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x29,0x20,0x2b,0x20,0x5f,0x33,0x38,0x5f,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x6d,
+    0x75,0x6c,0x28,0x5f,0x32,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x2c,0x20,0x6d,0x75,
+    0x6c,0x28,0x5f,0x32,0x30,0x5f,0x76,0x69,0x65,0x77,0x2c,0x20,0x5f,0x32,0x30,0x5f,
+    0x70,0x72,0x6f,0x6a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
+    0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer quant_params : register(b4)
+    {
+        float3 _80_pos_scale : packoffset(c0);
+        float3 _80_pos_offset : packoffset(c1);
+    };
 
-    @fragment
-    fn main(@location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(2) v_viewpos_param : vec3f) -> main_out {
-      v_pos_1 = v_pos_1_param;
-      v_normal_1 = v_normal_1_param;
-      v_viewpos = v_viewpos_param;
-      main_1();
-      return main_out(FragColor);
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _100_view : packoffset(c0);
+        row_major float4x4 _100_proj : packoffset(c4);
+        row_major float4x4 _100_model : packoffset(c8);
+        float3 _100_viewpos : packoffset(c12);
+    };
+
+
+    static float4 gl_Position;
+    static float4 position;
+    static float3 v_pos;
+    static float3 v_normal;
+    static float2 normal;
+    static float2 v_uv;
+    static float2 uv;
+    static float3 v_viewpos;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 position : TEXCOORD0;
+        float2 normal : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float3 v_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float2 v_uv : TEXCOORD2;
+        float3 v_viewpos : TEXCOORD3;
+        float4 gl_Position : SV_Position;
+    };
+
+    float3 oct_decode(float2 e)
+    {
+        float3 _24 = float3(e, (1.0f - abs(e.x)) - abs(e.y));
+        float3 n = _24;
+        float _33 = max(-_24.z, 0.0f);
+        n.x = _24.x - (((_24.x >= 0.0f) ? 1.0f : (-1.0f)) * _33);
+        n.y = _24.y - (((_24.y >= 0.0f) ? 1.0f : (-1.0f)) * _33);
+        return normalize(n);
+    }
+
+    void vert_main()
+    {
+        float4 _96 = float4((position.xyz * _80_pos_scale) + _80_pos_offset, 1.0f);
+        gl_Position = mul(_96, mul(_100_model, mul(_100_view, _100_proj)));
+        v_pos = float3(mul(_96, _100_model).xyz);
+        float2 param = normal;
+        v_normal = mul(oct_decode(param), float3x3(_100_model[0].xyz, _100_model[1].xyz, _100_model[2].xyz));
+        v_uv = uv;
+        v_viewpos = _100_viewpos;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        position = stage_input.position;
+        normal = stage_input.normal;
+        uv = stage_input.uv;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_pos = v_pos;
+        stage_output.v_normal = v_normal;
+        stage_output.v_uv = v_uv;
+        stage_output.v_viewpos = v_viewpos;
+        return stage_output;
     }
 */
-static const uint8_t pk_phong_color_fs_source_wgsl[2784] = {
-    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
-    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
-    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
-    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
-    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
-    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
-    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
-    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,
-    0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x64,
-    0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
-    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,
-    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
-    0x66,0x73,0x65,0x74,0x28,0x34,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,
-    0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,
-    0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,
-    0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,
-    0x66,0x6f,0x72,0x6d,0x3e,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,
-    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
-    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
-    0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
-    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
-    0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,
-    0x64,0x69,0x6e,0x67,0x28,0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
-    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
-    0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,
-    0x74,0x65,0x72,0x69,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
-    0x76,0x61,0x74,0x65,0x3e,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,
-    0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
-    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
-    0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,
-    0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,
-    0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,
-    0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
-    0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
-    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
-    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,
-    0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,
-    0x65,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-    0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,
-    0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,
-    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3e,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,
-    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,
-    0x32,0x3e,0x2c,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,
-    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x3e,0x29,0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,
-    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,
-    0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,
-    0x61,0x72,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,
-    0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,
-    0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,
-    0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,
-    0x6e,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
-    0x72,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
-    0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,
-    0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,
-    0x65,0x77,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
-    0x7a,0x65,0x28,0x28,0x2a,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,
-    0x20,0x2a,0x28,0x76,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,
-    0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x69,0x7a,0x65,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,
-    0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,
-    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,
-    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,
-    0x66,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,
-    0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,
-    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,
-    0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,
-    0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,
-    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,
-    0x30,0x66,0x29,0x2c,0x20,0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,
-    0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,
-    0x79,0x7a,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
-    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,
-    0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,
-    0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,
-    0x66,0x29,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
-    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,
-    0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,
-    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,
-    0x70,0x65,0x63,0x29,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,
-    0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,
-    0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,
-    0x6e,0x74,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,
-    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
-    0x78,0x5f,0x38,0x39,0x20,0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,
-    0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,
-    0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
-    0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
-    0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
-    0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
-    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,
-    0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,
-    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,
-    0x61,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
-    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,
-    0x6d,0x61,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,
-    0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x63,0x6f,0x6c,
-    0x5f,0x6d,0x61,0x74,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,
-    0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x63,
-    0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
-    0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x28,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
-    0x20,0x78,0x5f,0x31,0x32,0x36,0x20,0x3d,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,
-    0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
-    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,
-    0x76,0x66,0x34,0x5f,0x28,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x2c,0x20,0x26,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
-    0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x2c,0x20,0x26,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x36,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x78,
-    0x5f,0x31,0x32,0x36,0x3b,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,
-    0x2e,0x78,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x79,0x2c,0x20,0x72,0x65,
-    0x73,0x75,0x6c,0x74,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
-    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x46,
-    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
-    0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
-    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,
-    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,
-    0x31,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,
-    0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
-    0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
-    0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
-
+static const uint8_t pk_phong_packed_vs_source_hlsl5[1977] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x62,0x34,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x38,0x30,0x5f,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x38,0x30,0x5f,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,
+    0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x30,0x30,0x5f,
+    0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,
+    0x30,0x30,0x5f,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,
+    0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,
+    0x20,0x5f,0x31,0x30,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x31,0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x73,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
+    0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x63,0x74,0x5f,0x64,0x65,0x63,
+    0x6f,0x64,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x65,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x34,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x65,0x2c,0x20,0x28,0x31,0x2e,0x30,0x66,
+    0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x78,0x29,0x29,0x20,0x2d,0x20,0x61,
+    0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x6e,0x20,0x3d,0x20,0x5f,0x32,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x2d,0x5f,0x32,0x34,0x2e,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6e,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x32,0x34,0x2e,0x78,
+    0x20,0x2d,0x20,0x28,0x28,0x28,0x5f,0x32,0x34,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x66,0x29,0x20,0x3f,0x20,0x31,0x2e,0x30,0x66,0x20,0x3a,0x20,0x28,0x2d,
+    0x31,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x6e,0x2e,0x79,0x20,0x3d,0x20,0x5f,0x32,0x34,0x2e,0x79,0x20,0x2d,
+    0x20,0x28,0x28,0x28,0x5f,0x32,0x34,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,
+    0x66,0x29,0x20,0x3f,0x20,0x31,0x2e,0x30,0x66,0x20,0x3a,0x20,0x28,0x2d,0x31,0x2e,
+    0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,
+    0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x5f,0x38,0x30,0x5f,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,
+    0x65,0x29,0x20,0x2b,0x20,0x5f,0x38,0x30,0x5f,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,
+    0x6c,0x28,0x5f,0x39,0x36,0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x30,0x30,0x5f,
+    0x6d,0x6f,0x64,0x65,0x6c,0x2c,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x31,0x30,0x30,0x5f,
+    0x76,0x69,0x65,0x77,0x2c,0x20,0x5f,0x31,0x30,0x30,0x5f,0x70,0x72,0x6f,0x6a,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6d,0x75,0x6c,0x28,0x5f,0x39,0x36,0x2c,0x20,
+    0x5f,0x31,0x30,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x2e,0x78,0x79,0x7a,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,
+    0x6f,0x63,0x74,0x5f,0x64,0x65,0x63,0x6f,0x64,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x5f,0x31,0x30,0x30,
+    0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,
+    0x31,0x30,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x5f,0x31,0x30,0x30,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x5b,0x32,0x5d,0x2e,
+    0x78,0x79,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x31,0x30,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,
+    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     diagnostic(off, derivative_uniformity);
 
+    alias Arr = array<mat4x4f, 32u>;
+
+    struct bone_matrices {
+      /_ @offset(0) _/
+      bones : Arr,
+    }
+
     struct vs_params {
       /_ @offset(0) _/
       view : mat4x4f,
@@ -3019,16 +4074,22 @@ static const uint8_t pk_phong_color_fs_source_wgsl[2784] = {
       viewpos : vec3f,
     }
 
-    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+    var<private> bone_indices : vec4u;
 
-    var<private> position_1 : vec3f;
+    var<private> weights : vec4f;
+
+    @binding(1) @group(0) var<uniform> x_28 : bone_matrices;
+
+    var<private> pos : vec3f;
+
+    var<private> nrm : vec3f;
+
+    @binding(0) @group(0) var<uniform> x_134 : vs_params;
 
     var<private> v_pos : vec3f;
 
     var<private> v_normal : vec3f;
 
-    var<private> normal : vec3f;
-
     var<private> v_uv : vec2f;
 
     var<private> uv : vec2f;
@@ -3038,13 +4099,25 @@ static const uint8_t pk_phong_color_fs_source_wgsl[2784] = {
     var<private> gl_Position : vec4f;
 
     fn main_1() {
-      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      let x_52 = (x_20.model * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
-      v_pos = vec3f(x_52.x, x_52.y, x_52.z);
-      let x_59 = x_20.model;
-      v_normal = (mat3x3f(x_59[0u].xyz, x_59[1u].xyz, x_59[2u].xyz) * normal);
+      var idx : vec4u;
+      var skin_mat : mat4x4f;
+      var skinned_pos : vec4f;
+      var skinned_nrm : vec3f;
+      idx = bone_indices;
+      let x_37 = (x_28.bones[idx.x] * weights.x);
+      let x_45 = (x_28.bones[idx.y] * weights.y);
+      let x_58 = mat4x4f((x_37[0u] + x_45[0u]), (x_37[1u] + x_45[1u]), (x_37[2u] + x_45[2u]), (x_37[3u] + x_45[3u]));
+      let x_66 = (x_28.bones[idx.z] * weights.z);
+      let x_79 = mat4x4f((x_58[0u] + x_66[0u]), (x_58[1u] + x_66[1u]), (x_58[2u] + x_66[2u]), (x_58[3u] + x_66[3u]));
+      let x_87 = (x_28.bones[idx.w] * weights.w);
+      skin_mat = mat4x4f((x_79[0u] + x_87[0u]), (x_79[1u] + x_87[1u]), (x_79[2u] + x_87[2u]), (x_79[3u] + x_87[3u]));
+      skinned_pos = (skin_mat * vec4f(pos.x, pos.y, pos.z, 1.0f));
+      skinned_nrm = (mat3x3f(skin_mat[0u].xyz, skin_mat[1u].xyz, skin_mat[2u].xyz) * nrm);
+      gl_Position = (((x_134.proj * x_134.view) * x_134.model) * skinned_pos);
+      v_pos = skinned_pos.xyz;
+      v_normal = normalize(skinned_nrm);
       v_uv = uv;
-      v_viewpos = x_20.viewpos;
+      v_viewpos = x_134.viewpos;
       return;
     }
 
@@ -3062,406 +4135,3803 @@ static const uint8_t pk_phong_color_fs_source_wgsl[2784] = {
     }
 
     @vertex
-    fn main(@location(0) position_1_param : vec3f, @location(1) normal_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
-      position_1 = position_1_param;
-      normal = normal_param;
+    fn main(@location(3) @interpolate(flat) bone_indices_param : vec4u, @location(4) weights_param : vec4f, @location(0) pos_param : vec3f, @location(1) nrm_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
+      bone_indices = bone_indices_param;
+      weights = weights_param;
+      pos = pos_param;
+      nrm = nrm_param;
       uv = uv_param;
       main_1();
       return main_out(gl_Position, v_pos, v_normal, v_uv, v_viewpos);
     }
 */
-static const uint8_t pk_phong_tex_vs_source_wgsl[1423] = {
+static const uint8_t pk_skinned_vs_source_wgsl[2362] = {
     0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
     0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
-    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
-    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
-    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
-    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
-    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
-    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
-    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
-    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
-    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
-    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x61,0x6c,0x69,0x61,0x73,0x20,0x41,
+    0x72,0x72,0x20,0x3d,0x20,0x61,0x72,0x72,0x61,0x79,0x3c,0x6d,0x61,0x74,0x34,0x78,
+    0x34,0x66,0x2c,0x20,0x33,0x32,0x75,0x3e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,0x72,0x69,0x63,0x65,0x73,0x20,
+    0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x62,0x6f,0x6e,0x65,0x73,0x20,0x3a,0x20,0x41,
+    0x72,0x72,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,
+    0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,0x29,0x20,
+    0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,
+    0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,0x64,0x65,
+    0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,
+    0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,0x20,0x2a,
+    0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
+    0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x31,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,
+    0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,
+    0x32,0x38,0x20,0x3a,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x6d,0x61,0x74,0x72,0x69,0x63,
+    0x65,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x72,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,
+    0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,
+    0x31,0x33,0x34,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,
     0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
     0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
     0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,
     0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
-    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
-    0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
-    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
-    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
-    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
-    0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,
-    0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,
-    0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
-    0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,
-    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,
-    0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,
-    0x32,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,
-    0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,
-    0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,
-    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x35,0x32,0x2e,0x78,
-    0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x7a,
-    0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x39,0x20,0x3d,0x20,
-    0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x76,0x5f,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x33,0x78,0x33,
-    0x66,0x28,0x78,0x5f,0x35,0x39,0x5b,0x30,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,
-    0x78,0x5f,0x35,0x39,0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,
-    0x35,0x39,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
-    0x75,0x76,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
-    0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,
-    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
-    0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,
-    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
-    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
-    0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
-    0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,
-    0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x31,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,
-    0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
-    0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
-    0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,
-    0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,
-    0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
-    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,
-    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x69,0x64,0x78,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
+    0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,
+    0x34,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,
+    0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x37,0x20,0x3d,0x20,0x28,0x78,0x5f,
+    0x32,0x38,0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x78,0x5d,0x20,
+    0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x35,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
+    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x79,0x5d,0x20,0x2a,0x20,
+    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x35,0x38,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
+    0x28,0x28,0x78,0x5f,0x33,0x37,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,
+    0x35,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x33,0x37,0x5b,0x31,0x75,
+    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
+    0x78,0x5f,0x33,0x37,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,
+    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x33,0x37,0x5b,0x33,0x75,0x5d,0x20,
+    0x2b,0x20,0x78,0x5f,0x34,0x35,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x36,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
+    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x7a,0x5d,0x20,0x2a,0x20,
+    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x37,0x39,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
+    0x28,0x28,0x78,0x5f,0x35,0x38,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,
+    0x36,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x35,0x38,0x5b,0x31,0x75,
+    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
+    0x78,0x5f,0x35,0x38,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,
+    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x35,0x38,0x5b,0x33,0x75,0x5d,0x20,
+    0x2b,0x20,0x78,0x5f,0x36,0x36,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x38,
+    0x2e,0x62,0x6f,0x6e,0x65,0x73,0x5b,0x69,0x64,0x78,0x2e,0x77,0x5d,0x20,0x2a,0x20,
+    0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x73,0x6b,
+    0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
+    0x28,0x28,0x78,0x5f,0x37,0x39,0x5b,0x30,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,
+    0x37,0x5b,0x30,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x37,0x39,0x5b,0x31,0x75,
+    0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,0x31,0x75,0x5d,0x29,0x2c,0x20,0x28,
+    0x78,0x5f,0x37,0x39,0x5b,0x32,0x75,0x5d,0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,
+    0x32,0x75,0x5d,0x29,0x2c,0x20,0x28,0x78,0x5f,0x37,0x39,0x5b,0x33,0x75,0x5d,0x20,
+    0x2b,0x20,0x78,0x5f,0x38,0x37,0x5b,0x33,0x75,0x5d,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x73,
+    0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,
+    0x70,0x6f,0x73,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x2e,0x79,0x2c,0x20,0x70,0x6f,
+    0x73,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,
+    0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x28,0x6d,0x61,
+    0x74,0x33,0x78,0x33,0x66,0x28,0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,0x5b,0x30,
+    0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x73,0x6b,0x69,0x6e,0x5f,0x6d,0x61,0x74,
+    0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x73,0x6b,0x69,0x6e,0x5f,0x6d,
+    0x61,0x74,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x6e,0x72,
+    0x6d,0x29,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x31,0x33,0x34,0x2e,0x70,0x72,0x6f,
+    0x6a,0x20,0x2a,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,
+    0x2a,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,
+    0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,
+    0x5f,0x70,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x28,0x73,0x6b,0x69,0x6e,0x6e,0x65,0x64,0x5f,0x6e,0x72,0x6d,0x29,0x3b,0x0a,0x20,
+    0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x76,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x78,0x5f,0x31,0x33,0x34,0x2e,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,
+    0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,
+    0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,
+    0x29,0x20,0x40,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x28,0x66,
+    0x6c,0x61,0x74,0x29,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x2c,
+    0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,0x29,0x20,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x20,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,
+    0x29,0x20,0x6e,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,
+    0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
+    0x7b,0x0a,0x20,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,
+    0x20,0x3d,0x20,0x62,0x6f,0x6e,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,
+    0x20,0x3d,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x70,0x6f,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x72,0x6d,0x20,0x3d,0x20,0x6e,0x72,0x6d,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,
+    0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x76,0x5f,0x76,0x69,0x65,
+    0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     diagnostic(off, derivative_uniformity);
 
-    struct dir_light {
-      /_ @offset(0) _/
-      direction : vec3f,
-      /_ @offset(16) _/
-      ambient : vec4f,
-      /_ @offset(32) _/
-      diffuse : vec4f,
-      /_ @offset(48) _/
-      specular : vec4f,
-    }
-
-    struct tex_material {
+    struct vs_params {
       /_ @offset(0) _/
-      shininess : f32,
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
     }
 
-    @binding(11) @group(0) var<uniform> light : dir_light;
-
-    @binding(64) @group(1) var col_tex : texture_2d<f32>;
-
-    @binding(65) @group(1) var col_smp : sampler;
-
-    var<private> v_uv : vec2f;
-
-    var<private> v_pos_1 : vec3f;
-
-    var<private> v_normal_1 : vec3f;
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
 
-    var<private> v_viewpos : vec3f;
+    var<private> position_1 : vec3f;
 
-    @binding(10) @group(0) var<uniform> tex_mat : tex_material;
+    var<private> gl_Position : vec4f;
 
-    var<private> FragColor : vec4f;
+    fn main_1() {
+      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      return;
+    }
 
-    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
-      var norm : vec3f;
-      var view_dir : vec3f;
-      var light_dir : vec3f;
-      var diff : f32;
-      var reflect_dir : vec3f;
-      var spec : f32;
-      var ambient : vec3f;
-      var diffuse : vec3f;
-      var specular : vec3f;
-      norm = normalize(*(v_normal));
-      view_dir = normalize((*(viewpos) - *(v_pos)));
-      light_dir = normalize(-(light.direction));
-      diff = max(dot(norm, light_dir), 0.0f);
-      reflect_dir = reflect(-(light_dir), norm);
-      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
-      ambient = (light.ambient.xyz * *(material_ambient));
-      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
-      specular = ((light.specular.xyz * spec) * *(material_specular));
-      let x_86 = ambient;
-      let x_87 = diffuse;
-      let x_89 = specular;
-      return ((x_86 + x_87) + x_89);
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
     }
 
-    fn main_1() {
-      var tex : vec4f;
-      var result : vec3f;
-      var param : vec3f;
-      var param_1 : vec3f;
-      var param_2 : vec3f;
-      var param_3 : vec3f;
-      var param_4 : vec3f;
-      var param_5 : vec3f;
-      var param_6 : f32;
-      var param_7 : vec4f;
-      let x_107 = v_uv;
-      let x_108 = textureSample(col_tex, col_smp, x_107);
-      tex = x_108;
-      let x_117 = tex.w;
-      param = v_pos_1;
-      param_1 = v_normal_1;
-      param_2 = v_viewpos;
-      param_3 = tex.xyz;
-      param_4 = tex.xyz;
-      param_5 = vec3f(x_117);
-      param_6 = tex_mat.shininess;
-      param_7 = tex;
-      let x_141 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
-      result = x_141;
-      FragColor = vec4f(result.x, result.y, result.z, 1.0f);
+    @vertex
+    fn main(@location(0) position_1_param : vec3f) -> main_out {
+      position_1 = position_1_param;
+      main_1();
+      return main_out(gl_Position);
+    }
+*/
+static const uint8_t pk_unlit_col_vs_source_wgsl[696] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x20,
+    0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,0x20,0x78,
+    0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x78,0x2c,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct color {
+      /_ @offset(0) _/
+      col : vec4f,
+    }
+
+    var<private> frag_color : vec4f;
+
+    @binding(9) @group(0) var<uniform> x_12 : color;
+
+    fn main_1() {
+      frag_color = x_12.col;
       return;
     }
 
     struct main_out {
       @location(0)
-      FragColor_1 : vec4f,
+      frag_color_1 : vec4f,
     }
 
     @fragment
-    fn main(@location(2) v_uv_param : vec2f, @location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(3) v_viewpos_param : vec3f) -> main_out {
-      v_uv = v_uv_param;
-      v_pos_1 = v_pos_1_param;
-      v_normal_1 = v_normal_1_param;
-      v_viewpos = v_viewpos_param;
+    fn main() -> main_out {
       main_1();
-      return main_out(FragColor);
+      return main_out(frag_color);
     }
 */
-static const uint8_t pk_phong_tex_fs_source_wgsl[2939] = {
+static const uint8_t pk_unlit_col_fs_source_wgsl[369] = {
     0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
     0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
     0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
-    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
-    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
-    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
-    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
-    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
-    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
-    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
-    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
-    0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,
-    0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
-    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
-    0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,
-    0x74,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,
-    0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x63,
-    0x6f,0x6c,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
-    0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,
-    0x29,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
-    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
-    0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
-    0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
-    0x28,0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,
-    0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x74,0x65,0x78,0x5f,
-    0x6d,0x61,0x74,0x20,0x3a,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,
-    0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,
-    0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
-    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,
-    0x76,0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,
-    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
-    0x3e,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x70,0x74,
-    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,
-    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,
-    0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,
-    0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,
-    0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,
-    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,
-    0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,
-    0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,
-    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,
-    0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,0x32,0x3e,0x2c,0x20,
-    0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
-    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x34,0x66,0x3e,
-    0x29,0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,0x0a,0x20,0x20,0x76,
-    0x61,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
-    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6c,
-    0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
-    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,0x20,0x3a,0x20,0x66,
-    0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
-    0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,
-    0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,
-    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,
-    0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,
-    0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3d,0x20,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,
-    0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,
-    0x2a,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x2a,0x28,0x76,
-    0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,
-    0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-    0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
-    0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,
-    0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,
-    0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,
-    0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,
-    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,
-    0x64,0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x73,
-    0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,
-    0x74,0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,
-    0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,
-    0x20,0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x3b,0x0a,
-    0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x28,0x6c,0x69,0x67,
-    0x68,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,
-    0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,
-    0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
-    0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,
-    0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x29,0x20,0x2a,
-    0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,
-    0x75,0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
-    0x72,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x73,0x70,0x65,0x63,
-    0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x29,
-    0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,
-    0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
-    0x78,0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x64,0x69,0x66,
-    0x66,0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x39,
-    0x20,0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,0x20,0x2b,0x20,0x78,
-    0x5f,0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x63,0x6f,0x6c,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x39,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,
+    0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x3e,0x20,0x78,0x5f,0x31,0x32,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
     0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,
-    0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
-    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,
-    0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
-    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,
-    0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,0x20,
-    0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,
-    0x74,0x20,0x78,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x30,0x38,0x20,0x3d,0x20,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x63,0x6f,0x6c,0x5f,
-    0x74,0x65,0x78,0x2c,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,
-    0x31,0x30,0x37,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x20,0x3d,0x20,0x78,0x5f,
-    0x31,0x30,0x38,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x37,
-    0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
-    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x78,0x79,0x7a,0x3b,
-    0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,
-    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x31,0x31,0x37,0x29,0x3b,0x0a,
-    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,
-    0x6d,0x61,0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x70,0x68,
-    0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,
-    0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,
-    0x33,0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,0x26,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,
-    0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x34,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,
-    0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,
-    0x74,0x20,0x3d,0x20,0x78,0x5f,0x31,0x34,0x31,0x3b,0x0a,0x20,0x20,0x46,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x72,
-    0x65,0x73,0x75,0x6c,0x74,0x2e,0x78,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,
-    0x79,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,
-    0x66,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
-    0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
-    0x29,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,
-    0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x76,0x5f,0x75,0x76,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,
-    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
-    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,
-    0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
-    0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3d,0x20,0x76,
-    0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
-    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x76,
-    0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
-    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x78,0x5f,
+    0x31,0x32,0x2e,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,
+    0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x00,
 };
-static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backend) {
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> position_1 : vec3f;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> normal : vec3f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      v_uv = uv;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_uv_1 : vec2f,
+    }
+
+    @vertex
+    fn main(@location(0) position_1_param : vec3f, @location(2) uv_param : vec2f, @location(1) normal_param : vec3f) -> main_out {
+      position_1 = position_1_param;
+      uv = uv_param;
+      normal = normal_param;
+      main_1();
+      return main_out(gl_Position, v_uv);
+    }
+*/
+static const uint8_t pk_unlit_tex_vs_source_wgsl[940] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,
+    0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,
+    0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
+    0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,
+    0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,
+    0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,
+    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,
+    0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    @binding(64) @group(1) var tex : texture_2d<f32>;
+
+    @binding(65) @group(1) var smp : sampler;
+
+    var<private> v_uv : vec2f;
+
+    var<private> frag_color : vec4f;
+
+    fn main_1() {
+      var col : vec4f;
+      let x_23 = v_uv;
+      let x_24 = textureSample(tex, smp, x_23);
+      col = x_24;
+      frag_color = col;
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      frag_color_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) v_uv_param : vec2f) -> main_out {
+      v_uv = v_uv_param;
+      main_1();
+      return main_out(frag_color);
+    }
+*/
+static const uint8_t pk_unlit_tex_fs_source_wgsl[532] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,
+    0x67,0x28,0x36,0x34,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x33,
+    0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x32,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,
+    0x32,0x33,0x29,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x32,
+    0x34,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,
+    0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,
+    0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
+    0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> position_1 : vec3f;
+
+    var<private> v_pos : vec3f;
+
+    var<private> v_normal : vec3f;
+
+    var<private> normal : vec3f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> uv : vec2f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      let x_52 = (x_20.model * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      v_pos = vec3f(x_52.x, x_52.y, x_52.z);
+      let x_59 = x_20.model;
+      v_normal = (mat3x3f(x_59[0u].xyz, x_59[1u].xyz, x_59[2u].xyz) * normal);
+      v_viewpos = x_20.viewpos;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_pos_1 : vec3f,
+      @location(1)
+      v_normal_1 : vec3f,
+      @location(2)
+      v_viewpos_1 : vec3f,
+    }
+
+    @vertex
+    fn main(@location(0) position_1_param : vec3f, @location(1) normal_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
+      position_1 = position_1_param;
+      normal = normal_param;
+      uv = uv_param;
+      main_1();
+      return main_out(gl_Position, v_pos, v_normal, v_viewpos);
+    }
+*/
+static const uint8_t pk_phong_color_vs_source_wgsl[1343] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,
+    0x2e,0x70,0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,
+    0x77,0x29,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,
+    0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x31,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
+    0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
+    0x20,0x78,0x5f,0x35,0x32,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,
+    0x35,0x32,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x79,0x2c,0x20,0x78,0x5f,
+    0x35,0x32,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,
+    0x39,0x20,0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x3b,0x0a,
+    0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,
+    0x74,0x33,0x78,0x33,0x66,0x28,0x78,0x5f,0x35,0x39,0x5b,0x30,0x75,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x78,0x5f,0x35,0x39,0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x78,0x5f,0x35,0x39,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,
+    0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,
+    0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,
+    0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,
+    0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
+    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct dir_light {
+      /_ @offset(0) _/
+      direction : vec3f,
+      /_ @offset(16) _/
+      ambient : vec4f,
+      /_ @offset(32) _/
+      diffuse : vec4f,
+      /_ @offset(48) _/
+      specular : vec4f,
+    }
+
+    struct col_material {
+      /_ @offset(0) _/
+      ambient : vec4f,
+      /_ @offset(16) _/
+      diffuse : vec4f,
+      /_ @offset(32) _/
+      specular : vec4f,
+      /_ @offset(48) _/
+      shininess : f32,
+    }
+
+    @binding(11) @group(0) var<uniform> light : dir_light;
+
+    var<private> v_pos_1 : vec3f;
+
+    var<private> v_normal_1 : vec3f;
+
+    var<private> v_viewpos : vec3f;
+
+    @binding(10) @group(0) var<uniform> col_mat : col_material;
+
+    var<private> FragColor : vec4f;
+
+    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
+      var norm : vec3f;
+      var view_dir : vec3f;
+      var light_dir : vec3f;
+      var diff : f32;
+      var reflect_dir : vec3f;
+      var spec : f32;
+      var ambient : vec3f;
+      var diffuse : vec3f;
+      var specular : vec3f;
+      norm = normalize(*(v_normal));
+      view_dir = normalize((*(viewpos) - *(v_pos)));
+      light_dir = normalize(-(light.direction));
+      diff = max(dot(norm, light_dir), 0.0f);
+      reflect_dir = reflect(-(light_dir), norm);
+      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
+      ambient = (light.ambient.xyz * *(material_ambient));
+      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
+      specular = ((light.specular.xyz * spec) * *(material_specular));
+      let x_86 = ambient;
+      let x_87 = diffuse;
+      let x_89 = specular;
+      return ((x_86 + x_87) + x_89);
+    }
+
+    fn main_1() {
+      var result : vec3f;
+      var param : vec3f;
+      var param_1 : vec3f;
+      var param_2 : vec3f;
+      var param_3 : vec3f;
+      var param_4 : vec3f;
+      var param_5 : vec3f;
+      var param_6 : f32;
+      var param_7 : vec4f;
+      param = v_pos_1;
+      param_1 = v_normal_1;
+      param_2 = v_viewpos;
+      param_3 = col_mat.ambient.xyz;
+      param_4 = col_mat.diffuse.xyz;
+      param_5 = col_mat.specular.xyz;
+      param_6 = col_mat.shininess;
+      param_7 = vec4f(1.0f);
+      let x_126 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
+      result = x_126;
+      FragColor = vec4f(result.x, result.y, result.z, 1.0f);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      FragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(2) v_viewpos_param : vec3f) -> main_out {
+      v_pos_1 = v_pos_1_param;
+      v_normal_1 = v_normal_1_param;
+      v_viewpos = v_viewpos_param;
+      main_1();
+      return main_out(FragColor);
+    }
+*/
+static const uint8_t pk_phong_color_fs_source_wgsl[2784] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
+    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
+    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
+    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x34,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,
+    0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,
+    0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,
+    0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x3e,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,
+    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
+    0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,
+    0x74,0x65,0x72,0x69,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,
+    0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,
+    0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,
+    0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
+    0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,
+    0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,
+    0x61,0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,
+    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3e,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,
+    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,
+    0x32,0x3e,0x2c,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,
+    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3e,0x29,0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,
+    0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,
+    0x61,0x72,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,
+    0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,
+    0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,
+    0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,
+    0x6e,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,
+    0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,
+    0x65,0x77,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x28,0x2a,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,
+    0x20,0x2a,0x28,0x76,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,
+    0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,
+    0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,
+    0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,
+    0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,
+    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x29,0x2c,0x20,0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,
+    0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
+    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,
+    0x66,0x29,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,
+    0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,
+    0x70,0x65,0x63,0x29,0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,
+    0x6c,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,
+    0x6e,0x74,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,
+    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x38,0x39,0x20,0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,
+    0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,
+    0x20,0x2b,0x20,0x78,0x5f,0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,
+    0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,
+    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,
+    0x61,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,
+    0x6d,0x61,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x5f,0x6d,0x61,0x74,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
+    0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x28,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
+    0x20,0x78,0x5f,0x31,0x32,0x36,0x20,0x3d,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,
+    0x76,0x66,0x34,0x5f,0x28,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x2c,0x20,0x26,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x2c,0x20,0x26,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x36,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x78,
+    0x5f,0x31,0x32,0x36,0x3b,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x2e,0x78,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x79,0x2c,0x20,0x72,0x65,
+    0x73,0x75,0x6c,0x74,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,
+    0x31,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,
+    0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> position_1 : vec3f;
+
+    var<private> v_pos : vec3f;
+
+    var<private> v_normal : vec3f;
+
+    var<private> normal : vec3f;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      let x_52 = (x_20.model * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      v_pos = vec3f(x_52.x, x_52.y, x_52.z);
+      let x_59 = x_20.model;
+      v_normal = (mat3x3f(x_59[0u].xyz, x_59[1u].xyz, x_59[2u].xyz) * normal);
+      v_uv = uv;
+      v_viewpos = x_20.viewpos;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_pos_1 : vec3f,
+      @location(1)
+      v_normal_1 : vec3f,
+      @location(2)
+      v_uv_1 : vec2f,
+      @location(3)
+      v_viewpos_1 : vec3f,
+    }
+
+    @vertex
+    fn main(@location(0) position_1_param : vec3f, @location(1) normal_param : vec3f, @location(2) uv_param : vec2f) -> main_out {
+      position_1 = position_1_param;
+      normal = normal_param;
+      uv = uv_param;
+      main_1();
+      return main_out(gl_Position, v_pos, v_normal, v_uv, v_viewpos);
+    }
+*/
+static const uint8_t pk_phong_tex_vs_source_wgsl[1423] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
+    0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,
+    0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,
+    0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
+    0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x79,0x2c,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,
+    0x32,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,
+    0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,
+    0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,
+    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x35,0x32,0x2e,0x78,
+    0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x35,0x32,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x39,0x20,0x3d,0x20,
+    0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x76,0x5f,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x33,0x78,0x33,
+    0x66,0x28,0x78,0x5f,0x35,0x39,0x5b,0x30,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x78,0x5f,0x35,0x39,0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,
+    0x35,0x39,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x75,0x76,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
+    0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,
+    0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x31,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,
+    0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,
+    0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,
+    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct dir_light {
+      /_ @offset(0) _/
+      direction : vec3f,
+      /_ @offset(16) _/
+      ambient : vec4f,
+      /_ @offset(32) _/
+      diffuse : vec4f,
+      /_ @offset(48) _/
+      specular : vec4f,
+    }
+
+    struct tex_material {
+      /_ @offset(0) _/
+      shininess : f32,
+    }
+
+    @binding(11) @group(0) var<uniform> light : dir_light;
+
+    @binding(64) @group(1) var col_tex : texture_2d<f32>;
+
+    @binding(65) @group(1) var col_smp : sampler;
+
+    var<private> v_uv : vec2f;
+
+    var<private> v_pos_1 : vec3f;
+
+    var<private> v_normal_1 : vec3f;
+
+    var<private> v_viewpos : vec3f;
+
+    @binding(10) @group(0) var<uniform> tex_mat : tex_material;
+
+    var<private> FragColor : vec4f;
+
+    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
+      var norm : vec3f;
+      var view_dir : vec3f;
+      var light_dir : vec3f;
+      var diff : f32;
+      var reflect_dir : vec3f;
+      var spec : f32;
+      var ambient : vec3f;
+      var diffuse : vec3f;
+      var specular : vec3f;
+      norm = normalize(*(v_normal));
+      view_dir = normalize((*(viewpos) - *(v_pos)));
+      light_dir = normalize(-(light.direction));
+      diff = max(dot(norm, light_dir), 0.0f);
+      reflect_dir = reflect(-(light_dir), norm);
+      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
+      ambient = (light.ambient.xyz * *(material_ambient));
+      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
+      specular = ((light.specular.xyz * spec) * *(material_specular));
+      let x_86 = ambient;
+      let x_87 = diffuse;
+      let x_89 = specular;
+      return ((x_86 + x_87) + x_89);
+    }
+
+    fn main_1() {
+      var tex : vec4f;
+      var result : vec3f;
+      var param : vec3f;
+      var param_1 : vec3f;
+      var param_2 : vec3f;
+      var param_3 : vec3f;
+      var param_4 : vec3f;
+      var param_5 : vec3f;
+      var param_6 : f32;
+      var param_7 : vec4f;
+      let x_107 = v_uv;
+      let x_108 = textureSample(col_tex, col_smp, x_107);
+      tex = x_108;
+      let x_117 = tex.w;
+      param = v_pos_1;
+      param_1 = v_normal_1;
+      param_2 = v_viewpos;
+      param_3 = tex.xyz;
+      param_4 = tex.xyz;
+      param_5 = vec3f(x_117);
+      param_6 = tex_mat.shininess;
+      param_7 = tex;
+      let x_141 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
+      result = x_141;
+      FragColor = vec4f(result.x, result.y, result.z, 1.0f);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      FragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(2) v_uv_param : vec2f, @location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(3) v_viewpos_param : vec3f) -> main_out {
+      v_uv = v_uv_param;
+      v_pos_1 = v_pos_1_param;
+      v_normal_1 = v_normal_1_param;
+      v_viewpos = v_viewpos_param;
+      main_1();
+      return main_out(FragColor);
+    }
+*/
+static const uint8_t pk_phong_tex_fs_source_wgsl[2939] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
+    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
+    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
+    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+    0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,
+    0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x63,
+    0x6f,0x6c,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,
+    0x29,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x28,0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,
+    0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x74,0x65,0x78,0x5f,
+    0x6d,0x61,0x74,0x20,0x3a,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,
+    0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,
+    0x76,0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,
+    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3e,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x70,0x74,
+    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,
+    0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,
+    0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,
+    0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,
+    0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,
+    0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,
+    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,
+    0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,0x32,0x3e,0x2c,0x20,
+    0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x34,0x66,0x3e,
+    0x29,0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,0x0a,0x20,0x20,0x76,
+    0x61,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
+    0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,
+    0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3d,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,
+    0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,
+    0x2a,0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x2a,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,
+    0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,
+    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x64,0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x73,
+    0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,
+    0x74,0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,
+    0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,
+    0x20,0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x28,0x6c,0x69,0x67,
+    0x68,0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+    0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,
+    0x73,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x29,0x20,0x2a,
+    0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x29,
+    0x20,0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,
+    0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x39,
+    0x20,0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,0x20,0x2b,0x20,0x78,
+    0x5f,0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,
+    0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,0x20,
+    0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x30,0x38,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x63,0x6f,0x6c,0x5f,
+    0x74,0x65,0x78,0x2c,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,
+    0x31,0x30,0x37,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x20,0x3d,0x20,0x78,0x5f,
+    0x31,0x30,0x38,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x37,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x31,0x31,0x37,0x29,0x3b,0x0a,
+    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,
+    0x6d,0x61,0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x70,0x68,
+    0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,
+    0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,
+    0x33,0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,0x26,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,
+    0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,
+    0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x20,0x3d,0x20,0x78,0x5f,0x31,0x34,0x31,0x3b,0x0a,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x72,
+    0x65,0x73,0x75,0x6c,0x74,0x2e,0x78,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,
+    0x79,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,
+    0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x76,0x5f,0x75,0x76,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,0x20,
+    0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
+    0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3d,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> inst_m0 : vec4f;
+
+    var<private> inst_m1 : vec4f;
+
+    var<private> inst_m2 : vec4f;
+
+    var<private> inst_m3 : vec4f;
+
+    var<private> position_1 : vec3f;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> v_color : vec4f;
+
+    var<private> inst_color : vec4f;
+
+    var<private> normal : vec3f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      let x_39 = mat4x4f(inst_m0, inst_m1, inst_m2, inst_m3);
+      gl_Position = (((x_20.proj * x_20.view) * (x_39 * x_20.model)) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      v_uv = uv;
+      v_color = inst_color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_uv_1 : vec2f,
+      @location(1)
+      v_color_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@location(3) inst_m0_param : vec4f, @location(4) inst_m1_param : vec4f, @location(5) inst_m2_param : vec4f, @location(6) inst_m3_param : vec4f, @location(0) position_1_param : vec3f, @location(2) uv_param : vec2f, @location(7) inst_color_param : vec4f, @location(1) normal_param : vec3f) -> main_out {
+      inst_m0 = inst_m0_param;
+      inst_m1 = inst_m1_param;
+      inst_m2 = inst_m2_param;
+      inst_m3 = inst_m3_param;
+      position_1 = position_1_param;
+      uv = uv_param;
+      inst_color = inst_color_param;
+      normal = normal_param;
+      main_1();
+      return main_out(gl_Position, v_uv, v_color);
+    }
+*/
+static const uint8_t pk_unlit_inst_vs_source_wgsl[1589] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,
+    0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x39,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x28,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,
+    0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x32,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x29,0x3b,0x0a,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,
+    0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,0x20,0x28,0x78,0x5f,0x33,0x39,0x20,
+    0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x29,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,
+    0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,
+    0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,
+    0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,
+    0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x35,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x36,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,
+    0x33,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,
+    0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x37,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x29,
+    0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x31,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x20,0x3d,
+    0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,
+    0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x33,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,
+    0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct color {
+      /_ @offset(0) _/
+      col : vec4f,
+    }
+
+    var<private> frag_color : vec4f;
+
+    var<private> v_color : vec4f;
+
+    var<private> v_uv : vec2f;
+
+    @binding(9) @group(0) var<uniform> x_12 : color;
+
+    fn main_1() {
+      let x_16 = x_12.col;
+      let x_19 = v_color;
+      frag_color = (x_16 * x_19);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      frag_color_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(1) v_color_param : vec4f, @location(0) v_uv_param : vec2f) -> main_out {
+      v_color = v_color_param;
+      v_uv = v_uv_param;
+      main_1();
+      return main_out(frag_color);
+    }
+*/
+static const uint8_t pk_unlit_col_inst_fs_source_wgsl[593] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x63,0x6f,0x6c,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x39,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x31,
+    0x32,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x31,0x36,0x20,0x3d,0x20,0x78,0x5f,0x31,0x32,0x2e,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x39,0x20,0x3d,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x78,0x5f,0x31,0x36,0x20,0x2a,0x20,0x78,0x5f,
+    0x31,0x39,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,
+    0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,
+    0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    @binding(64) @group(1) var tex : texture_2d<f32>;
+
+    @binding(65) @group(1) var smp : sampler;
+
+    var<private> v_uv : vec2f;
+
+    var<private> v_color : vec4f;
+
+    var<private> frag_color : vec4f;
+
+    fn main_1() {
+      var col : vec4f;
+      let x_23 = v_uv;
+      let x_24 = textureSample(tex, smp, x_23);
+      col = x_24;
+      let x_28 = v_color;
+      frag_color = (col * x_28);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      frag_color_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) v_uv_param : vec2f, @location(1) v_color_param : vec4f) -> main_out {
+      v_uv = v_uv_param;
+      v_color = v_color_param;
+      main_1();
+      return main_out(frag_color);
+    }
+*/
+static const uint8_t pk_unlit_tex_inst_fs_source_wgsl[657] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,
+    0x67,0x28,0x36,0x34,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x33,0x20,
+    0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,
+    0x32,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,0x32,
+    0x33,0x29,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x32,0x34,
+    0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x38,0x20,0x3d,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x78,0x5f,
+    0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,
+    0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x75,
+    0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,
+    0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> inst_m0 : vec4f;
+
+    var<private> inst_m1 : vec4f;
+
+    var<private> inst_m2 : vec4f;
+
+    var<private> inst_m3 : vec4f;
+
+    var<private> position_1 : vec3f;
+
+    var<private> v_pos : vec3f;
+
+    var<private> v_normal : vec3f;
+
+    var<private> normal : vec3f;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> v_color : vec4f;
+
+    var<private> inst_color : vec4f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      var world : mat4x4f;
+      world = (mat4x4f(inst_m0, inst_m1, inst_m2, inst_m3) * x_20.model);
+      gl_Position = (((x_20.proj * x_20.view) * world) * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      let x_70 = (world * vec4f(position_1.x, position_1.y, position_1.z, 1.0f));
+      v_pos = vec3f(x_70.x, x_70.y, x_70.z);
+      let x_77 = world;
+      v_normal = (mat3x3f(x_77[0u].xyz, x_77[1u].xyz, x_77[2u].xyz) * normal);
+      v_uv = uv;
+      v_viewpos = x_20.viewpos;
+      v_color = inst_color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_pos_1 : vec3f,
+      @location(1)
+      v_normal_1 : vec3f,
+      @location(2)
+      v_uv_1 : vec2f,
+      @location(3)
+      v_viewpos_1 : vec3f,
+      @location(4)
+      v_color_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@location(3) inst_m0_param : vec4f, @location(4) inst_m1_param : vec4f, @location(5) inst_m2_param : vec4f, @location(6) inst_m3_param : vec4f, @location(0) position_1_param : vec3f, @location(1) normal_param : vec3f, @location(2) uv_param : vec2f, @location(7) inst_color_param : vec4f) -> main_out {
+      inst_m0 = inst_m0_param;
+      inst_m1 = inst_m1_param;
+      inst_m2 = inst_m2_param;
+      inst_m3 = inst_m3_param;
+      position_1 = position_1_param;
+      normal = normal_param;
+      uv = uv_param;
+      inst_color = inst_color_param;
+      main_1();
+      return main_out(gl_Position, v_pos, v_normal, v_uv, v_viewpos, v_color);
+    }
+*/
+static const uint8_t pk_phong_inst_vs_source_wgsl[2083] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,
+    0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,
+    0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,0x5f,
+    0x6d,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,
+    0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,
+    0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3a,0x20,
+    0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x3b,0x0a,0x20,0x20,0x77,0x6f,0x72,0x6c,0x64,
+    0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x28,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x30,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x2c,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x32,0x2c,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x29,0x20,
+    0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x3b,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,
+    0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,
+    0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,0x20,0x77,0x6f,0x72,0x6c,0x64,
+    0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,
+    0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x37,0x30,0x20,0x3d,0x20,0x28,0x77,0x6f,0x72,0x6c,0x64,0x20,
+    0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,
+    0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x2e,0x7a,
+    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x37,0x30,0x2e,0x78,
+    0x2c,0x20,0x78,0x5f,0x37,0x30,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x37,0x30,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,0x37,0x20,0x3d,0x20,
+    0x77,0x6f,0x72,0x6c,0x64,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x33,0x78,0x33,0x66,0x28,0x78,0x5f,0x37,
+    0x37,0x5b,0x30,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,0x37,0x37,0x5b,
+    0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,0x37,0x37,0x5b,0x32,0x75,
+    0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,
+    0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,0x78,0x5f,0x32,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
+    0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,
+    0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x32,0x29,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x33,0x29,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,0x29,0x0a,0x20,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,
+    0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x34,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x35,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x36,0x29,0x20,0x69,0x6e,0x73,0x74,
+    0x5f,0x6d,0x33,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x37,0x29,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x30,0x20,0x3d,0x20,0x69,0x6e,0x73,
+    0x74,0x5f,0x6d,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x31,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x31,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,
+    0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x32,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x3b,0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x6d,0x33,0x20,0x3d,0x20,0x69,0x6e,
+    0x73,0x74,0x5f,0x6d,0x33,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x73,0x74,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x76,0x5f,0x76,0x69,0x65,
+    0x77,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct dir_light {
+      /_ @offset(0) _/
+      direction : vec3f,
+      /_ @offset(16) _/
+      ambient : vec4f,
+      /_ @offset(32) _/
+      diffuse : vec4f,
+      /_ @offset(48) _/
+      specular : vec4f,
+    }
+
+    struct col_material {
+      /_ @offset(0) _/
+      ambient : vec4f,
+      /_ @offset(16) _/
+      diffuse : vec4f,
+      /_ @offset(32) _/
+      specular : vec4f,
+      /_ @offset(48) _/
+      shininess : f32,
+    }
+
+    @binding(11) @group(0) var<uniform> light : dir_light;
+
+    var<private> v_pos_1 : vec3f;
+
+    var<private> v_normal_1 : vec3f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> v_color : vec4f;
+
+    var<private> v_uv : vec2f;
+
+    @binding(10) @group(0) var<uniform> col_mat : col_material;
+
+    var<private> FragColor : vec4f;
+
+    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
+      var norm : vec3f;
+      var view_dir : vec3f;
+      var light_dir : vec3f;
+      var diff : f32;
+      var reflect_dir : vec3f;
+      var spec : f32;
+      var ambient : vec3f;
+      var diffuse : vec3f;
+      var specular : vec3f;
+      norm = normalize(*(v_normal));
+      view_dir = normalize((*(viewpos) - *(v_pos)));
+      light_dir = normalize(-(light.direction));
+      diff = max(dot(norm, light_dir), 0.0f);
+      reflect_dir = reflect(-(light_dir), norm);
+      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
+      ambient = (light.ambient.xyz * *(material_ambient));
+      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
+      specular = ((light.specular.xyz * spec) * *(material_specular));
+      let x_86 = ambient;
+      let x_87 = diffuse;
+      let x_89 = specular;
+      return ((x_86 + x_87) + x_89);
+    }
+
+    fn main_1() {
+      var result : vec3f;
+      var param : vec3f;
+      var param_1 : vec3f;
+      var param_2 : vec3f;
+      var param_3 : vec3f;
+      var param_4 : vec3f;
+      var param_5 : vec3f;
+      var param_6 : f32;
+      var param_7 : vec4f;
+      param = v_pos_1;
+      param_1 = v_normal_1;
+      param_2 = v_viewpos;
+      param_3 = col_mat.ambient.xyz;
+      param_4 = col_mat.diffuse.xyz;
+      param_5 = col_mat.specular.xyz;
+      param_6 = col_mat.shininess;
+      param_7 = vec4f(1.0f);
+      let x_126 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
+      result = x_126;
+      let x_133 = v_color;
+      FragColor = (vec4f(result.x, result.y, result.z, 1.0f) * x_133);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      FragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(3) v_viewpos_param : vec3f, @location(4) v_color_param : vec4f, @location(2) v_uv_param : vec2f) -> main_out {
+      v_pos_1 = v_pos_1_param;
+      v_normal_1 = v_normal_1_param;
+      v_viewpos = v_viewpos_param;
+      v_color = v_color_param;
+      v_uv = v_uv_param;
+      main_1();
+      return main_out(FragColor);
+    }
+*/
+static const uint8_t pk_phong_color_inst_fs_source_wgsl[2993] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
+    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
+    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
+    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x34,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,
+    0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,
+    0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,
+    0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x3e,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,
+    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,
+    0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x63,0x6f,0x6c,0x5f,0x6d,
+    0x61,0x74,0x20,0x3a,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,
+    0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,
+    0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,0x76,
+    0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,
+    0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x70,0x74,0x72,
+    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,
+    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,
+    0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x70,
+    0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,
+    0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,
+    0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x73,
+    0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,0x32,0x3e,0x2c,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x34,0x66,0x3e,0x29,
+    0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,
+    0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3d,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,
+    0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x2a,
+    0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x2a,0x28,0x76,0x5f,
+    0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+    0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,
+    0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,
+    0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,
+    0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,
+    0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,
+    0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,
+    0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x29,0x20,0x2a,0x20,
+    0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,
+    0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x29,0x20,
+    0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,
+    0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x39,0x20,
+    0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,0x20,0x2b,0x20,0x78,0x5f,
+    0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x76,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x2e,0x61,0x6d,
+    0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x2e,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,0x74,0x2e,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6d,0x61,
+    0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x31,
+    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x32,
+    0x36,0x20,0x3d,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,
+    0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,
+    0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,
+    0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x26,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,
+    0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x78,0x5f,0x31,0x32,0x36,0x3b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x33,0x33,0x20,0x3d,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x34,0x66,0x28,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2e,0x78,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x79,0x2c,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,
+    0x20,0x2a,0x20,0x78,0x5f,0x31,0x33,0x33,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x76,0x5f,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x34,0x29,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,
+    0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
+    0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct dir_light {
+      /_ @offset(0) _/
+      direction : vec3f,
+      /_ @offset(16) _/
+      ambient : vec4f,
+      /_ @offset(32) _/
+      diffuse : vec4f,
+      /_ @offset(48) _/
+      specular : vec4f,
+    }
+
+    struct tex_material {
+      /_ @offset(0) _/
+      shininess : f32,
+    }
+
+    @binding(11) @group(0) var<uniform> light : dir_light;
+
+    @binding(64) @group(1) var col_tex : texture_2d<f32>;
+
+    @binding(65) @group(1) var col_smp : sampler;
+
+    var<private> v_uv : vec2f;
+
+    var<private> v_pos_1 : vec3f;
+
+    var<private> v_normal_1 : vec3f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> v_color : vec4f;
+
+    @binding(10) @group(0) var<uniform> tex_mat : tex_material;
+
+    var<private> FragColor : vec4f;
+
+    fn phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(v_pos : ptr<function, vec3f>, v_normal : ptr<function, vec3f>, viewpos : ptr<function, vec3f>, material_ambient : ptr<function, vec3f>, material_diffuse : ptr<function, vec3f>, material_specular : ptr<function, vec3f>, shininess : ptr<function, f32>, tex_color : ptr<function, vec4f>) -> vec3f {
+      var norm : vec3f;
+      var view_dir : vec3f;
+      var light_dir : vec3f;
+      var diff : f32;
+      var reflect_dir : vec3f;
+      var spec : f32;
+      var ambient : vec3f;
+      var diffuse : vec3f;
+      var specular : vec3f;
+      norm = normalize(*(v_normal));
+      view_dir = normalize((*(viewpos) - *(v_pos)));
+      light_dir = normalize(-(light.direction));
+      diff = max(dot(norm, light_dir), 0.0f);
+      reflect_dir = reflect(-(light_dir), norm);
+      spec = pow(max(dot(view_dir, reflect_dir), 0.0f), *(shininess));
+      ambient = (light.ambient.xyz * *(material_ambient));
+      diffuse = ((light.diffuse.xyz * diff) * *(material_diffuse));
+      specular = ((light.specular.xyz * spec) * *(material_specular));
+      let x_86 = ambient;
+      let x_87 = diffuse;
+      let x_89 = specular;
+      return ((x_86 + x_87) + x_89);
+    }
+
+    fn main_1() {
+      var tex : vec4f;
+      var result : vec3f;
+      var param : vec3f;
+      var param_1 : vec3f;
+      var param_2 : vec3f;
+      var param_3 : vec3f;
+      var param_4 : vec3f;
+      var param_5 : vec3f;
+      var param_6 : f32;
+      var param_7 : vec4f;
+      let x_107 = v_uv;
+      let x_108 = textureSample(col_tex, col_smp, x_107);
+      tex = x_108;
+      let x_117 = tex.w;
+      param = v_pos_1;
+      param_1 = v_normal_1;
+      param_2 = v_viewpos;
+      param_3 = tex.xyz;
+      param_4 = tex.xyz;
+      param_5 = vec3f(x_117);
+      param_6 = tex_mat.shininess;
+      param_7 = tex;
+      let x_141 = phong_light_vf3_vf3_vf3_vf3_vf3_vf3_f1_vf4_(&(param), &(param_1), &(param_2), &(param_3), &(param_4), &(param_5), &(param_6), &(param_7));
+      result = x_141;
+      let x_148 = v_color;
+      FragColor = (vec4f(result.x, result.y, result.z, 1.0f) * x_148);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      FragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(2) v_uv_param : vec2f, @location(0) v_pos_1_param : vec3f, @location(1) v_normal_1_param : vec3f, @location(3) v_viewpos_param : vec3f, @location(4) v_color_param : vec4f) -> main_out {
+      v_uv = v_uv_param;
+      v_pos_1 = v_pos_1_param;
+      v_normal_1 = v_normal_1_param;
+      v_viewpos = v_viewpos_param;
+      v_color = v_color_param;
+      main_1();
+      return main_out(FragColor);
+    }
+*/
+static const uint8_t pk_phong_tex_inst_fs_source_wgsl[3066] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
+    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,
+    0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,
+    0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+    0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x31,0x31,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,
+    0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x63,
+    0x6f,0x6c,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,
+    0x29,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x31,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,
+    0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x74,0x65,0x78,0x5f,0x6d,
+    0x61,0x74,0x20,0x3a,0x20,0x74,0x65,0x78,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,
+    0x6c,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x70,0x68,0x6f,0x6e,0x67,0x5f,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,
+    0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x66,0x31,0x5f,0x76,
+    0x66,0x34,0x5f,0x28,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,
+    0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x70,0x74,0x72,
+    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3e,0x2c,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,
+    0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,
+    0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x70,
+    0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x3e,0x2c,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,
+    0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,
+    0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x3e,0x2c,0x20,0x73,
+    0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x33,0x32,0x3e,0x2c,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x34,0x66,0x3e,0x29,
+    0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,0x66,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,0x66,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,
+    0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3d,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2a,0x28,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,
+    0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x2a,
+    0x28,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x2a,0x28,0x76,0x5f,
+    0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+    0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,
+    0x6e,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x64,
+    0x69,0x72,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,
+    0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x76,0x69,0x65,0x77,0x5f,0x64,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,
+    0x63,0x74,0x5f,0x64,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x2a,0x28,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x61,0x6d,0x62,0x69,0x65,
+    0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,
+    0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x29,0x20,0x2a,0x20,
+    0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x64,0x69,0x66,0x66,0x75,
+    0x73,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x20,0x3d,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x29,0x20,
+    0x2a,0x20,0x2a,0x28,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5f,0x73,0x70,0x65,
+    0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x38,0x36,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x39,0x20,
+    0x3d,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x78,0x5f,0x38,0x36,0x20,0x2b,0x20,0x78,0x5f,
+    0x38,0x37,0x29,0x20,0x2b,0x20,0x78,0x5f,0x38,0x39,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,
+    0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
+    0x20,0x78,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x30,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x63,0x6f,0x6c,0x5f,0x74,
+    0x65,0x78,0x2c,0x20,0x63,0x6f,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x78,0x5f,0x31,
+    0x30,0x37,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x20,0x3d,0x20,0x78,0x5f,0x31,
+    0x30,0x38,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x37,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,
+    0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,
+    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x31,0x31,0x37,0x29,0x3b,0x0a,0x20,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x6d,
+    0x61,0x74,0x2e,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x70,0x68,0x6f,
+    0x6e,0x67,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,0x5f,0x76,0x66,0x33,
+    0x5f,0x66,0x31,0x5f,0x76,0x66,0x34,0x5f,0x28,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x26,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
+    0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x26,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x2c,0x20,0x26,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x20,0x3d,0x20,0x78,0x5f,0x31,0x34,0x31,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x31,0x34,0x38,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,
+    0x76,0x65,0x63,0x34,0x66,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x78,0x2c,0x20,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x79,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x20,0x2a,0x20,0x78,0x5f,0x31,0x34,
+    0x38,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x0a,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,
+    0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x76,0x5f,0x75,0x76,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x20,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,0x29,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
+    0x7b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,
+    0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3d,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x3b,0x0a,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    struct quant_params {
+      /_ @offset(0) _/
+      pos_scale : vec3f,
+      /_ @offset(16) _/
+      pos_offset : vec3f,
+    }
+
+    @binding(0) @group(0) var<uniform> x_20 : vs_params;
+
+    var<private> position_1 : vec4f;
+
+    @binding(4) @group(0) var<uniform> x_38 : quant_params;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> normal : vec2f;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      var pos : vec3f;
+      let x_34 = position_1;
+      pos = ((vec3f(x_34.x, x_34.y, x_34.z) * x_38.pos_scale) + x_38.pos_offset);
+      let x_61 = pos;
+      gl_Position = (((x_20.proj * x_20.view) * x_20.model) * vec4f(x_61.x, x_61.y, x_61.z, 1.0f));
+      v_uv = uv;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_uv_1 : vec2f,
+    }
+
+    @vertex
+    fn main(@location(0) position_1_param : vec4f, @location(2) uv_param : vec2f, @location(1) normal_param : vec2f) -> main_out {
+      position_1 = position_1_param;
+      uv = uv_param;
+      normal = normal_param;
+      main_1();
+      return main_out(gl_Position, v_uv);
+    }
+*/
+static const uint8_t pk_unlit_packed_vs_source_wgsl[1226] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,
+    0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,
+    0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,
+    0x64,0x65,0x6c,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,
+    0x2a,0x2f,0x0a,0x20,0x20,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x6f,
+    0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x30,0x29,
+    0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x32,0x30,0x20,0x3a,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x28,0x34,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,
+    0x78,0x5f,0x33,0x38,0x20,0x3a,0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,
+    0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,
+    0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x34,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x31,0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,
+    0x28,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x33,0x34,0x2e,0x78,0x2c,0x20,0x78,
+    0x5f,0x33,0x34,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x33,0x34,0x2e,0x7a,0x29,0x20,0x2a,
+    0x20,0x78,0x5f,0x33,0x38,0x2e,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,
+    0x20,0x2b,0x20,0x78,0x5f,0x33,0x38,0x2e,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x31,0x20,
+    0x3d,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x28,0x78,0x5f,0x32,0x30,0x2e,0x70,
+    0x72,0x6f,0x6a,0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,
+    0x20,0x2a,0x20,0x78,0x5f,0x32,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x78,0x5f,0x36,0x31,0x2e,0x78,0x2c,0x20,0x78,
+    0x5f,0x36,0x31,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x36,0x31,0x2e,0x7a,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x75,0x76,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,
+    0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,
+    0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,
+    0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct quant_params {
+      /_ @offset(0) _/
+      pos_scale : vec3f,
+      /_ @offset(16) _/
+      pos_offset : vec3f,
+    }
+
+    struct vs_params {
+      /_ @offset(0) _/
+      view : mat4x4f,
+      /_ @offset(64) _/
+      proj : mat4x4f,
+      /_ @offset(128) _/
+      model : mat4x4f,
+      /_ @offset(192) _/
+      viewpos : vec3f,
+    }
+
+    var<private> position_1 : vec4f;
+
+    @binding(4) @group(0) var<uniform> x_80 : quant_params;
+
+    @binding(0) @group(0) var<uniform> x_100 : vs_params;
+
+    var<private> v_pos : vec3f;
+
+    var<private> v_normal : vec3f;
+
+    var<private> normal : vec2f;
+
+    var<private> v_uv : vec2f;
+
+    var<private> uv : vec2f;
+
+    var<private> v_viewpos : vec3f;
+
+    var<private> gl_Position : vec4f;
+
+    fn oct_decode_vf2_(e : ptr<function, vec2f>) -> vec3f {
+      var n : vec3f;
+      var t : f32;
+      let x_20 = *(e);
+      n = vec3f(x_20.x, x_20.y, ((1.0f - abs(x_20.x)) - abs(x_20.y)));
+      t = max(-(n.z), 0.0f);
+      n.x = (n.x - (select(-1.0f, 1.0f, (n.x >= 0.0f)) * t));
+      n.y = (n.y - (select(-1.0f, 1.0f, (n.y >= 0.0f)) * t));
+      return normalize(n);
+    }
+
+    fn main_1() {
+      var pos : vec4f;
+      var param : vec2f;
+      let x_76 = position_1;
+      let x_90 = ((vec3f(x_76.x, x_76.y, x_76.z) * x_80.pos_scale) + x_80.pos_offset);
+      pos = vec4f(x_90.x, x_90.y, x_90.z, 1.0f);
+      gl_Position = (((x_100.proj * x_100.view) * x_100.model) * pos);
+      let x_118 = (x_100.model * pos);
+      v_pos = vec3f(x_118.x, x_118.y, x_118.z);
+      let x_125 = x_100.model;
+      param = normal;
+      let x_136 = oct_decode_vf2_(&(param));
+      v_normal = (mat3x3f(x_125[0u].xyz, x_125[1u].xyz, x_125[2u].xyz) * x_136);
+      v_uv = uv;
+      v_viewpos = x_100.viewpos;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      v_pos_1 : vec3f,
+      @location(1)
+      v_normal_1 : vec3f,
+      @location(2)
+      v_uv_1 : vec2f,
+      @location(3)
+      v_viewpos_1 : vec3f,
+    }
+
+    @vertex
+    fn main(@location(0) position_1_param : vec4f, @location(1) normal_param : vec2f, @location(2) uv_param : vec2f) -> main_out {
+      position_1 = position_1_param;
+      normal = normal_param;
+      uv = uv_param;
+      main_1();
+      return main_out(gl_Position, v_pos, v_normal, v_uv, v_viewpos);
+    }
+*/
+static const uint8_t pk_phong_packed_vs_source_wgsl[2094] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,
+    0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,
+    0x2f,0x0a,0x20,0x20,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x70,0x6f,0x73,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x76,0x69,0x65,0x77,
+    0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,0x29,0x20,0x2a,0x2f,0x0a,
+    0x20,0x20,0x70,0x72,0x6f,0x6a,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,
+    0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x3a,
+    0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x39,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,
+    0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x34,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,
+    0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x38,0x30,0x20,0x3a,
+    0x20,0x71,0x75,0x61,0x6e,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,
+    0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,
+    0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x3e,0x20,0x78,0x5f,0x31,0x30,0x30,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6f,
+    0x63,0x74,0x5f,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x76,0x66,0x32,0x5f,0x28,0x65,
+    0x20,0x3a,0x20,0x70,0x74,0x72,0x3c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x3e,0x29,0x20,0x2d,0x3e,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x6e,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x30,0x20,0x3d,
+    0x20,0x2a,0x28,0x65,0x29,0x3b,0x0a,0x20,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x33,0x66,0x28,0x78,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x32,0x30,0x2e,
+    0x79,0x2c,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,
+    0x78,0x5f,0x32,0x30,0x2e,0x78,0x29,0x29,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x78,
+    0x5f,0x32,0x30,0x2e,0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x74,0x20,0x3d,0x20,
+    0x6d,0x61,0x78,0x28,0x2d,0x28,0x6e,0x2e,0x7a,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x6e,0x2e,0x78,0x20,0x3d,0x20,0x28,0x6e,0x2e,0x78,0x20,
+    0x2d,0x20,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x2d,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x28,0x6e,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6e,
+    0x2e,0x79,0x20,0x3d,0x20,0x28,0x6e,0x2e,0x79,0x20,0x2d,0x20,0x28,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x28,0x2d,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x28,0x6e,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x29,0x20,
+    0x2a,0x20,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,
+    0x36,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x39,0x30,0x20,0x3d,0x20,0x28,0x28,0x76,
+    0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x37,0x36,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x37,
+    0x36,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x37,0x36,0x2e,0x7a,0x29,0x20,0x2a,0x20,0x78,
+    0x5f,0x38,0x30,0x2e,0x70,0x6f,0x73,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x20,0x2b,
+    0x20,0x78,0x5f,0x38,0x30,0x2e,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x29,0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x28,0x78,0x5f,0x39,0x30,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x39,0x30,0x2e,0x79,0x2c,
+    0x20,0x78,0x5f,0x39,0x30,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x28,0x28,0x28,0x78,0x5f,0x31,0x30,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x20,0x2a,0x20,
+    0x78,0x5f,0x31,0x30,0x30,0x2e,0x76,0x69,0x65,0x77,0x29,0x20,0x2a,0x20,0x78,0x5f,
+    0x31,0x30,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x20,0x2a,0x20,0x70,0x6f,0x73,
+    0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x38,0x20,0x3d,
+    0x20,0x28,0x78,0x5f,0x31,0x30,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x2a,0x20,
+    0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x31,0x31,0x38,0x2e,0x78,0x2c,0x20,0x78,
+    0x5f,0x31,0x31,0x38,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x31,0x31,0x38,0x2e,0x7a,0x29,
+    0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x32,0x35,0x20,0x3d,0x20,
+    0x78,0x5f,0x31,0x30,0x30,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x33,0x36,0x20,0x3d,0x20,0x6f,0x63,0x74,
+    0x5f,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x76,0x66,0x32,0x5f,0x28,0x26,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x33,0x78,0x33,0x66,0x28,0x78,0x5f,
+    0x31,0x32,0x35,0x5b,0x30,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,0x31,
+    0x32,0x35,0x5b,0x31,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x78,0x5f,0x31,0x32,
+    0x35,0x5b,0x32,0x75,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x78,0x5f,0x31,
+    0x33,0x36,0x29,0x3b,0x0a,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x78,0x5f,0x31,0x30,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
+    0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x2c,
+    0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,
+    0x20,0x20,0x76,0x5f,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,
+    0x0a,0x20,0x20,0x76,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x5f,0x31,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x33,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,
+    0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,
+    0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
+    0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x3b,0x0a,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,
+    0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x76,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "col_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.label = "pk_phong_color_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.label = "pk_phong_color_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.label = "pk_phong_color_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_phong_color_inst_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_inst_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].glsl_name = "inst_m0";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "inst_m1";
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].glsl_name = "inst_m2";
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].glsl_name = "inst_m3";
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].glsl_name = "inst_color";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "col_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.label = "pk_phong_color_inst_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_inst_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[5].hlsl_sem_index = 5;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[6].hlsl_sem_index = 6;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[7].hlsl_sem_index = 7;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.label = "pk_phong_color_inst_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_color_inst_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.label = "pk_phong_color_inst_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
+            desc.label = "pk_phong_tex_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 65;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_phong_tex_inst_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_inst_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].glsl_name = "inst_m0";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "inst_m1";
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].glsl_name = "inst_m2";
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].glsl_name = "inst_m3";
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].glsl_name = "inst_color";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
+            desc.label = "pk_phong_tex_inst_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_inst_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[5].hlsl_sem_index = 5;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[6].hlsl_sem_index = 6;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[7].hlsl_sem_index = 7;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_inst_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_inst_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_inst_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 65;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_inst_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_phong_tex_packed_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_packed_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[4].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[4].glsl_uniforms[0].glsl_name = "quant_params";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
+            desc.label = "pk_phong_tex_packed_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_packed_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].hlsl_register_b_n = 4;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_packed_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_phong_packed_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].wgsl_group0_binding_n = 4;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 65;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_phong_tex_packed_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_skinned_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "pos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "nrm";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
+            desc.attrs[3].glsl_name = "bone_indices";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "weights";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 2048;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 128;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "bone_matrices";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
+            desc.label = "pk_skinned_phong_tex_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_skinned_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 2048;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].hlsl_register_b_n = 2;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_skinned_phong_tex_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_skinned_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 2048;
+            desc.uniform_blocks[1].wgsl_group0_binding_n = 1;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 65;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "pk_skinned_phong_tex_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_unlit_color_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "position";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "color";
+            desc.label = "pk_unlit_color_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.label = "pk_unlit_color_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].wgsl_group0_binding_n = 9;
+            desc.label = "pk_unlit_color_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* pk_unlit_color_inst_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_glsl430;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_glsl430;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_glsl430;
+            desc.fragment_func.source = (const char*)pk_unlit_col_inst_fs_source_glsl430;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[0].glsl_name = "position";
@@ -3469,25 +7939,29 @@ static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backen
             desc.attrs[1].glsl_name = "normal";
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].glsl_name = "uv";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].glsl_name = "inst_m0";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "inst_m1";
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].glsl_name = "inst_m2";
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].glsl_name = "inst_m3";
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].glsl_name = "inst_color";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 64;
-            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 4;
-            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "col_material";
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
-            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
-            desc.label = "pk_phong_color_shader";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "color";
+            desc.label = "pk_unlit_color_inst_shader";
         }
         return &desc;
     }
@@ -3496,10 +7970,10 @@ static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backen
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_hlsl5;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_hlsl5;
             desc.vertex_func.d3d11_target = "vs_5_0";
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_hlsl5;
+            desc.fragment_func.source = (const char*)pk_unlit_col_inst_fs_source_hlsl5;
             desc.fragment_func.d3d11_target = "ps_5_0";
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
@@ -3511,19 +7985,30 @@ static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backen
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].hlsl_sem_name = "TEXCOORD";
             desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[5].hlsl_sem_index = 5;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[6].hlsl_sem_index = 6;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[7].hlsl_sem_index = 7;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 64;
-            desc.uniform_blocks[2].hlsl_register_b_n = 2;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].hlsl_register_b_n = 3;
-            desc.label = "pk_phong_color_shader";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.label = "pk_unlit_color_inst_shader";
         }
         return &desc;
     }
@@ -3532,40 +8017,41 @@ static inline const sg_shader_desc* pk_phong_color_shader_desc(sg_backend backen
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_color_vs_source_wgsl;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_wgsl;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_color_fs_source_wgsl;
+            desc.fragment_func.source = (const char*)pk_unlit_col_inst_fs_source_wgsl;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 64;
-            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
-            desc.label = "pk_phong_color_shader";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].wgsl_group0_binding_n = 9;
+            desc.label = "pk_unlit_color_inst_shader";
         }
         return &desc;
     }
     return 0;
 }
-static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend) {
+static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_glsl430;
+            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_glsl430;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_glsl430;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_glsl430;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[0].glsl_name = "position";
@@ -3579,18 +8065,6 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
-            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
-            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3600,8 +8074,8 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
-            desc.label = "pk_phong_tex_shader";
+            desc.texture_sampler_pairs[0].glsl_name = "tex_smp";
+            desc.label = "pk_unlit_tex_shader";
         }
         return &desc;
     }
@@ -3610,10 +8084,10 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_hlsl5;
+            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_hlsl5;
             desc.vertex_func.d3d11_target = "vs_5_0";
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_hlsl5;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_hlsl5;
             desc.fragment_func.d3d11_target = "ps_5_0";
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
@@ -3629,14 +8103,6 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].hlsl_register_b_n = 2;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].hlsl_register_b_n = 3;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3648,7 +8114,7 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_phong_tex_shader";
+            desc.label = "pk_unlit_tex_shader";
         }
         return &desc;
     }
@@ -3657,9 +8123,9 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_phong_tex_vs_source_wgsl;
+            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_wgsl;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_wgsl;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_wgsl;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
@@ -3668,14 +8134,6 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3687,56 +8145,44 @@ static inline const sg_shader_desc* pk_phong_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_phong_tex_shader";
+            desc.label = "pk_unlit_tex_shader";
         }
         return &desc;
     }
     return 0;
 }
-static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend backend) {
+static inline const sg_shader_desc* pk_unlit_tex_inst_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_skinned_vs_source_glsl430;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_glsl430;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_glsl430;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_inst_fs_source_glsl430;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[0].glsl_name = "pos";
+            desc.attrs[0].glsl_name = "position";
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[1].glsl_name = "nrm";
+            desc.attrs[1].glsl_name = "normal";
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].glsl_name = "uv";
-            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
-            desc.attrs[3].glsl_name = "bone_indices";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].glsl_name = "inst_m0";
             desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[4].glsl_name = "weights";
+            desc.attrs[4].glsl_name = "inst_m1";
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].glsl_name = "inst_m2";
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].glsl_name = "inst_m3";
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].glsl_name = "inst_color";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 2048;
-            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 128;
-            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "bone_matrices";
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
-            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "tex_material";
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
-            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "dir_light";
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3746,8 +8192,8 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.texture_sampler_pairs[0].glsl_name = "col_tex_col_smp";
-            desc.label = "pk_skinned_phong_tex_shader";
+            desc.texture_sampler_pairs[0].glsl_name = "tex_smp";
+            desc.label = "pk_unlit_tex_inst_shader";
         }
         return &desc;
     }
@@ -3756,10 +8202,10 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_skinned_vs_source_hlsl5;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_hlsl5;
             desc.vertex_func.d3d11_target = "vs_5_0";
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_hlsl5;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_inst_fs_source_hlsl5;
             desc.fragment_func.d3d11_target = "ps_5_0";
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
@@ -3771,28 +8217,25 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].hlsl_sem_name = "TEXCOORD";
             desc.attrs[2].hlsl_sem_index = 2;
-            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[3].hlsl_sem_name = "TEXCOORD";
             desc.attrs[3].hlsl_sem_index = 3;
             desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[4].hlsl_sem_name = "TEXCOORD";
             desc.attrs[4].hlsl_sem_index = 4;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[5].hlsl_sem_index = 5;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[6].hlsl_sem_index = 6;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[7].hlsl_sem_index = 7;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 2048;
-            desc.uniform_blocks[1].hlsl_register_b_n = 1;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].hlsl_register_b_n = 2;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].hlsl_register_b_n = 3;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3804,7 +8247,7 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_skinned_phong_tex_shader";
+            desc.label = "pk_unlit_tex_inst_shader";
         }
         return &desc;
     }
@@ -3813,31 +8256,22 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_skinned_vs_source_wgsl;
+            desc.vertex_func.source = (const char*)pk_unlit_inst_vs_source_wgsl;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_phong_tex_fs_source_wgsl;
+            desc.fragment_func.source = (const char*)pk_unlit_tex_inst_fs_source_wgsl;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_UINT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[5].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[6].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[7].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 2048;
-            desc.uniform_blocks[1].wgsl_group0_binding_n = 1;
-            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[2].size = 16;
-            desc.uniform_blocks[2].wgsl_group0_binding_n = 10;
-            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[3].size = 64;
-            desc.uniform_blocks[3].wgsl_group0_binding_n = 11;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3849,97 +8283,19 @@ static inline const sg_shader_desc* pk_skinned_phong_tex_shader_desc(sg_backend
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_skinned_phong_tex_shader";
-        }
-        return &desc;
-    }
-    return 0;
-}
-static inline const sg_shader_desc* pk_unlit_color_shader_desc(sg_backend backend) {
-    if (backend == SG_BACKEND_GLCORE) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_glsl430;
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_glsl430;
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[0].glsl_name = "position";
-            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 208;
-            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
-            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 16;
-            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
-            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "color";
-            desc.label = "pk_unlit_color_shader";
-        }
-        return &desc;
-    }
-    if (backend == SG_BACKEND_D3D11) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_hlsl5;
-            desc.vertex_func.d3d11_target = "vs_5_0";
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_hlsl5;
-            desc.fragment_func.d3d11_target = "ps_5_0";
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
-            desc.attrs[0].hlsl_sem_index = 0;
-            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 208;
-            desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 16;
-            desc.uniform_blocks[1].hlsl_register_b_n = 1;
-            desc.label = "pk_unlit_color_shader";
-        }
-        return &desc;
-    }
-    if (backend == SG_BACKEND_WGPU) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_col_vs_source_wgsl;
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pk_unlit_col_fs_source_wgsl;
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
-            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
-            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 208;
-            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 16;
-            desc.uniform_blocks[1].wgsl_group0_binding_n = 9;
-            desc.label = "pk_unlit_color_shader";
+            desc.label = "pk_unlit_tex_inst_shader";
         }
         return &desc;
     }
     return 0;
 }
-static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend) {
+static inline const sg_shader_desc* pk_unlit_tex_packed_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_glsl430;
+            desc.vertex_func.source = (const char*)pk_unlit_packed_vs_source_glsl430;
             desc.vertex_func.entry = "main";
             desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_glsl430;
             desc.fragment_func.entry = "main";
@@ -3955,6 +8311,12 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[4].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[4].glsl_uniforms[0].glsl_name = "quant_params";
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3965,7 +8327,7 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
             desc.texture_sampler_pairs[0].glsl_name = "tex_smp";
-            desc.label = "pk_unlit_tex_shader";
+            desc.label = "pk_unlit_tex_packed_shader";
         }
         return &desc;
     }
@@ -3974,7 +8336,7 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_hlsl5;
+            desc.vertex_func.source = (const char*)pk_unlit_packed_vs_source_hlsl5;
             desc.vertex_func.d3d11_target = "vs_5_0";
             desc.vertex_func.entry = "main";
             desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_hlsl5;
@@ -3993,6 +8355,10 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].hlsl_register_b_n = 4;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -4004,7 +8370,7 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_unlit_tex_shader";
+            desc.label = "pk_unlit_tex_packed_shader";
         }
         return &desc;
     }
@@ -4013,7 +8379,7 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pk_unlit_tex_vs_source_wgsl;
+            desc.vertex_func.source = (const char*)pk_unlit_packed_vs_source_wgsl;
             desc.vertex_func.entry = "main";
             desc.fragment_func.source = (const char*)pk_unlit_tex_fs_source_wgsl;
             desc.fragment_func.entry = "main";
@@ -4024,6 +8390,10 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
             desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 32;
+            desc.uniform_blocks[4].wgsl_group0_binding_n = 4;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -4035,7 +8405,7 @@ static inline const sg_shader_desc* pk_unlit_tex_shader_desc(sg_backend backend)
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[0].view_slot = 0;
             desc.texture_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "pk_unlit_tex_shader";
+            desc.label = "pk_unlit_tex_packed_shader";
         }
         return &desc;
     }
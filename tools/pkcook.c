@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+//  pkcook.c
+//  Cooks gltf files into the binary format of pk_load_cooked_model.
+//  usage: pkcook [--packed] input.gltf output.pkm
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#define PK_NO_SAPP
+#include "../poki.c"
+
+static int usage(void) {
+    fprintf(stderr, "usage: pkcook [--packed] input.gltf output.pkm\n");
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    pk_cook_desc desc = { 0 };
+    const char* input = NULL;
+    const char* output = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--packed") == 0) desc.packed_vertices = true;
+        else if (!input) input = argv[i];
+        else if (!output) output = argv[i];
+        else return usage();
+    }
+    if (!input || !output) return usage();
+
+    cgltf_options options = { 0 };
+    cgltf_data* gltf = NULL;
+    if (cgltf_parse_file(&options, input, &gltf) != cgltf_result_success ||
+        cgltf_load_buffers(&options, gltf, input) != cgltf_result_success) {
+        fprintf(stderr, "failed to load %s\n", input);
+        cgltf_free(gltf);
+        return 1;
+    }
+
+    size_t size = 0;
+    void* cooked = pk_cook_gltf(pk_get_allocator(), gltf, &desc, &size);
+    cgltf_free(gltf);
+
+    FILE* file = fopen(output, "wb");
+    if (!file || fwrite(cooked, 1, size, file) != size) {
+        fprintf(stderr, "failed to write %s\n", output);
+        if (file) fclose(file);
+        pk_free(pk_get_allocator(), cooked);
+        return 1;
+    }
+    fclose(file);
+    pk_free(pk_get_allocator(), cooked);
+    printf("%s: %zu bytes\n", output, size);
+    return 0;
+}